@@ -0,0 +1,281 @@
+/** @file
+ * Measures the throughput of physics and collision hot paths. Results are printed as JSON.
+ */
+
+#include "Game.hpp"
+#include "GameEngine/ConvexBoundingPolygon.hpp"
+#include "GameEngine/Geometry.hpp"
+#include "GameEngine/Physics/DynamicObject.hpp"
+#include "GameEngine/Physics/Integrator.hpp"
+#include "GameEngine/Physics/JumpAndRunObject.hpp"
+#include "GameEngine/Physics/StaticObject.hpp"
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <glm/gtc/constants.hpp>
+#include <glm/gtx/rotate_vector.hpp>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using namespace GameEngine;
+
+namespace {
+/** Each benchmark gets measured multiple times. The fastest repetition is the least disturbed. */
+constexpr size_t repetitions = 5;
+
+/** Fixed seed to make all generated scenes reproducible. */
+constexpr std::mt19937::result_type seed = 1337;
+
+/** Prevents the compiler from optimizing away results of measured code. */
+volatile float result_sink = 0;
+
+/** Function performing the given amount of operations, e.g. ticks or function calls. */
+using Workload = std::function<void(size_t operations)>;
+
+struct Result {
+  std::string name;
+
+  /** Amount of operations performed by each repetition. */
+  size_t operations;
+
+  /** Time taken by each repetition. */
+  std::vector<std::chrono::nanoseconds> durations;
+};
+
+/** Measure a single benchmark.
+ *
+ * @param make_workload Will be called before each repetition to prepare a fresh scene. Not part of
+ * the measured time.
+ */
+Result measure(std::string name, const size_t operations,
+               const std::function<Workload()> &make_workload) {
+  Result result{std::move(name), operations, {}};
+  for (size_t repetition = 0; repetition < repetitions; ++repetition) {
+    const auto workload = make_workload();
+    const auto start = std::chrono::steady_clock::now();
+    workload(operations);
+    result.durations.push_back(std::chrono::steady_clock::now() - start);
+  }
+  return result;
+}
+
+/** Objects simulated by a dedicated integrator. */
+struct Scene {
+  Physics::Integrator integrator;
+  std::vector<std::unique_ptr<Physics::Object>> objects;
+};
+
+Workload simulate(std::shared_ptr<Scene> scene) {
+  return [scene](const size_t ticks) {
+    for (size_t tick = 0; tick < ticks; ++tick) {
+      scene->integrator.integrate(Physics::Integrator::getTickDuration(), scene->objects);
+    }
+  };
+}
+
+template <typename T>
+std::unique_ptr<T> makeBox(const glm::vec2 center, const glm::vec2 half_size) {
+  return std::make_unique<T>(std::initializer_list<glm::vec2>{
+      center - half_size, center + glm::vec2{half_size.x, -half_size.y}, center + half_size,
+      center + glm::vec2{-half_size.x, half_size.y}});
+}
+
+std::unique_ptr<Physics::StaticObject> makeLine(const glm::vec2 start, const glm::vec2 end) {
+  return std::make_unique<Physics::StaticObject>(std::initializer_list<glm::vec2>{start, end});
+}
+
+/** @return Regular polygon with a radius of 1. */
+Geometry::VertexList makeRegularPolygon(const size_t vertex_count) {
+  Geometry::VertexList vertices;
+  for (size_t index = 0; index < vertex_count; ++index) {
+    vertices.push_back(
+        glm::rotate(glm::vec2{1, 0}, glm::two_pi<float>() * index / vertex_count));
+  }
+  return vertices;
+}
+
+/** Boxes falling into the level of the demo game, rows above each other. */
+Workload makeDemoLevelScene(const size_t box_count) {
+  auto game = std::make_shared<Game>(1280, 800);
+  game->addDynamicBoxRows(box_count);
+  return [game](const size_t ticks) {
+    for (size_t tick = 0; tick < ticks; ++tick) {
+      game->integratePhysics(Physics::Integrator::getTickDuration());
+    }
+  };
+}
+
+/** Demo game being filled with boxes and reset again, like when pressing R. */
+Workload makeDemoResetScene(const size_t box_count) {
+  auto game = std::make_shared<Game>(1280, 800);
+  return [game, box_count](const size_t resets) {
+    for (size_t reset = 0; reset < resets; ++reset) {
+      game->addDynamicBoxRows(box_count);
+      game->reset();
+    }
+  };
+}
+
+/** Columns of boxes stacked on top of each other, standing on a static floor. */
+Workload makeBoxStackScene(const size_t column_count, const size_t boxes_per_column) {
+  auto scene = std::make_shared<Scene>();
+  const auto floor_width = column_count * 0.6f;
+  scene->objects.push_back(makeBox<Physics::StaticObject>({floor_width / 2, -0.5f},
+                                                          {floor_width / 2 + 1, 0.5f}));
+  for (size_t column = 0; column < column_count; ++column) {
+    for (size_t row = 0; row < boxes_per_column; ++row) {
+      const glm::vec2 center{0.3f + column * 0.6f, 0.26f + row * 0.51f};
+      scene->objects.push_back(makeBox<Physics::DynamicObject>(center, {0.25, 0.25}));
+    }
+  }
+  return simulate(std::move(scene));
+}
+
+/** Jump-and-run objects running in both directions over a long zigzag ramp. */
+Workload makeRampScene(const size_t runner_count) {
+  auto scene = std::make_shared<Scene>();
+  constexpr size_t segment_count = 64;
+  constexpr float segment_width = 4;
+  constexpr float segment_height = 2;
+  const auto ramp_width = segment_count * segment_width;
+  for (size_t segment = 0; segment < segment_count; ++segment) {
+    scene->objects.push_back(makeLine({segment * segment_width, (segment % 2) * segment_height},
+                                      {(segment + 1) * segment_width,
+                                       ((segment + 1) % 2) * segment_height}));
+  }
+  scene->objects.push_back(makeLine({0, 0}, {0, 20}));
+  scene->objects.push_back(makeLine({ramp_width, 0}, {ramp_width, 20}));
+
+  for (size_t index = 0; index < runner_count; ++index) {
+    const glm::vec2 center{(index + 0.5f) * ramp_width / runner_count, segment_height + 1};
+    auto runner = makeBox<Physics::JumpAndRunObject>(center, {0.25, 0.5});
+    runner->run(index % 2 == 0 ? HorizontalDirection::Right : HorizontalDirection::Left);
+    scene->objects.push_back(std::move(runner));
+  }
+  return simulate(std::move(scene));
+}
+
+/** Randomly placed and rotated polygons, about half of the tested pairs overlap. */
+Workload makeCollisionScene(const size_t vertex_count) {
+  auto polygons = std::make_shared<std::vector<ConvexBoundingPolygon>>();
+  std::mt19937 generator{seed};
+  std::uniform_real_distribution<float> position{0, 4};
+  std::uniform_real_distribution<float> orientation{0, glm::two_pi<float>()};
+  for (size_t index = 0; index < 256; ++index) {
+    auto &polygon = polygons->emplace_back(makeRegularPolygon(vertex_count));
+    polygon.setPosition({position(generator), position(generator)});
+    polygon.setOrientation(orientation(generator));
+  }
+  return [polygons](const size_t calls) {
+    size_t collisions = 0;
+    for (size_t call = 0; call < calls; ++call) {
+      const auto &a = (*polygons)[call % polygons->size()];
+      const auto &b = (*polygons)[(call * 7 + 1) % polygons->size()];
+      collisions += a.collidesWith(b).has_value() ? 1 : 0;
+    }
+    result_sink = static_cast<float>(collisions);
+  };
+}
+
+/** Ways of iterating over the edges of a polygon. */
+enum class EdgeTraversal { Template, StdFunction, Range };
+
+Workload makeEdgeScene(const size_t vertex_count, const EdgeTraversal traversal) {
+  auto polygon = std::make_shared<Geometry::VertexList>(makeRegularPolygon(vertex_count));
+  return [polygon, traversal](const size_t calls) {
+    float total_length = 0;
+    const auto add_length = [&](const glm::vec2 start, const glm::vec2 end) {
+      total_length += glm::distance(start, end);
+    };
+    const std::function<void(glm::vec2, glm::vec2)> type_erased_add_length = add_length;
+    for (size_t call = 0; call < calls; ++call) {
+      switch (traversal) {
+      case EdgeTraversal::Template:
+        Geometry::forEachEdge(*polygon, add_length);
+        break;
+      case EdgeTraversal::StdFunction:
+        Geometry::forEachEdge(*polygon, type_erased_add_length);
+        break;
+      case EdgeTraversal::Range:
+        for (const auto [start, end] : Geometry::edges(*polygon)) {
+          add_length(start, end);
+        }
+        break;
+      }
+    }
+    result_sink = total_length;
+  };
+}
+
+/** Run all benchmarks whose name contains the given filter. */
+std::vector<Result> runBenchmarks(const std::string_view filter) {
+  std::vector<Result> results;
+  const auto run = [&](std::string name, const size_t operations,
+                       const std::function<Workload()> &make_workload) {
+    if (name.find(filter) != std::string::npos) {
+      std::cerr << "Running " << name << std::endl;
+      results.push_back(measure(std::move(name), operations, make_workload));
+    }
+  };
+
+  for (const size_t box_count : {50, 200, 800}) {
+    run("integrate/demo_level/boxes=" + std::to_string(box_count), 600,
+        [=] { return makeDemoLevelScene(box_count); });
+  }
+  run("reset/demo_level/boxes=800", 200, [] { return makeDemoResetScene(800); });
+  for (const size_t columns : {10, 40}) {
+    run("integrate/box_stacks/columns=" + std::to_string(columns) + ",height=10", 600,
+        [=] { return makeBoxStackScene(columns, 10); });
+  }
+  for (const size_t runner_count : {16, 128}) {
+    run("integrate/jump_and_run_ramp/runners=" + std::to_string(runner_count), 600,
+        [=] { return makeRampScene(runner_count); });
+  }
+  for (size_t vertex_count = 3; vertex_count <= 16; ++vertex_count) {
+    run("collides_with/vertices=" + std::to_string(vertex_count), 200000,
+        [=] { return makeCollisionScene(vertex_count); });
+  }
+  for (const auto &[name, traversal] :
+       {std::pair{"for_each_edge", EdgeTraversal::Template},
+        std::pair{"for_each_edge_std_function", EdgeTraversal::StdFunction},
+        std::pair{"edge_range", EdgeTraversal::Range}}) {
+    for (size_t vertex_count = 3; vertex_count <= 16; ++vertex_count) {
+      run(std::string{name} + "/vertices=" + std::to_string(vertex_count), 1000000,
+          [=, traversal = traversal] { return makeEdgeScene(vertex_count, traversal); });
+    }
+  }
+  return results;
+}
+
+void printJson(const std::vector<Result> &results) {
+  std::cout << "{\n  \"repetitions\": " << repetitions << ",\n  \"benchmarks\": [";
+  for (size_t index = 0; index < results.size(); ++index) {
+    const auto &result = results[index];
+    auto durations = result.durations;
+    std::sort(durations.begin(), durations.end());
+    const auto nanoseconds_per_operation = [&](const std::chrono::nanoseconds duration) {
+      return static_cast<double>(duration.count()) / result.operations;
+    };
+    const auto fastest = nanoseconds_per_operation(durations.front());
+    const auto median = nanoseconds_per_operation(durations[durations.size() / 2]);
+
+    std::cout << (index == 0 ? "\n" : ",\n") << "    {\"name\": \"" << result.name
+              << "\", \"operations\": " << result.operations
+              << ", \"ns_per_operation_min\": " << fastest
+              << ", \"ns_per_operation_median\": " << median
+              << ", \"operations_per_second\": " << 1e9 / fastest << "}";
+  }
+  std::cout << "\n  ]\n}" << std::endl;
+}
+} // namespace
+
+/** Usage: Benchmark [filter]. Only benchmarks containing the filter in their name will run. */
+int main(int argc, char *argv[]) {
+  const std::string_view filter = argc > 1 ? argv[1] : "";
+  printJson(runBenchmarks(filter));
+}
@@ -4,72 +4,125 @@
 
 #include "Game.hpp"
 #include "GameEngine/Geometry.hpp"
-#include "GameEngine/Physics/StaticObject.hpp"
+#include <cstring>
 
 using namespace GameEngine;
 
 namespace {
 template <typename T>
-std::unique_ptr<T> makeBox(const glm::vec2 center, const float width, const float height) {
+typename ObjectPool<T>::Handle createBox(ObjectPool<T> &pool, const glm::vec2 center,
+                                         const float width, const float height) {
   const glm::vec2 box_half_width = {width / 2, 0};
   const glm::vec2 box_half_height = {0, height / 2};
-  return std::make_unique<T>(std::initializer_list<glm::vec2>{
+  return pool.create(std::initializer_list<glm::vec2>{
       center - box_half_width - box_half_height, center - box_half_width + box_half_height,
       center + box_half_width + box_half_height, center + box_half_width - box_half_height});
 }
 
-std::unique_ptr<Physics::StaticObject> makeStaticObject(std::initializer_list<glm::vec2> vertices) {
-  return std::make_unique<Physics::StaticObject>(vertices);
+Geometry::VertexList makeBoxShape(const glm::vec2 center, const float width, const float height) {
+  const glm::vec2 box_half_width = {width / 2, 0};
+  const glm::vec2 box_half_height = {0, height / 2};
+  return {center - box_half_width - box_half_height, center - box_half_width + box_half_height,
+          center + box_half_width + box_half_height, center + box_half_width - box_half_height};
+}
+
+/** Mix the bit pattern of the given vector into the given FNV-1a hash. */
+uint64_t combineHash(uint64_t hash, const glm::vec2 vector) {
+  for (const float value : {vector.x, vector.y}) {
+    uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    for (size_t byte = 0; byte < sizeof(bits); ++byte) {
+      hash = (hash ^ ((bits >> (byte * 8)) & 0xff)) * 1099511628211ull;
+    }
+  }
+  return hash;
 }
 } // namespace
 
 namespace GameEngine {
 Game::Game(const size_t screen_width, const size_t screen_height)
-    : camera{screen_width, screen_height} {
-  objects.push_back(makeBox<Physics::JumpAndRunObject>({1.625, -7.625}, 1.0, 1.0));
-  camera.setPosition(getGameCharacter().getBoundingPolygon().getPosition());
+    : screen_width{screen_width}, screen_height{screen_height},
+      camera{screen_width, screen_height} {
+  createLevel();
+}
 
-  objects.push_back(makeStaticObject({{0.25, 100}, {31.75, 100}}));     /* Ceiling. */
-  objects.push_back(makeStaticObject({{0.25, 100}, {0.25, -19.5}}));    /* Left wall. */
-  objects.push_back(makeStaticObject({{31.75, 100}, {31.75, -19.5}}));  /* Right wall. */
-  objects.push_back(makeStaticObject({{0.25, -19.5}, {31.75, -19.5}})); /* Ground. */
+void Game::createLevel() {
+  game_character = createBox(characters, {1.625, -7.625}, 1.0, 1.0);
+  objects.push_back(&getGameCharacter());
+  camera.setPosition(getGameCharacter().getBoundingPolygon().getPosition());
 
-  objects.push_back(makeBox<Physics::StaticObject>({21.75, -17.625}, 3.75, 3.75));
+  std::vector<Geometry::VertexList> level{
+      {{0.25, 100}, {31.75, 100}},     /* Ceiling. */
+      {{0.25, 100}, {0.25, -19.5}},    /* Left wall. */
+      {{31.75, 100}, {31.75, -19.5}},  /* Right wall. */
+      {{0.25, -19.5}, {31.75, -19.5}}, /* Ground. */
+  };
+  level.push_back(makeBoxShape({21.75, -17.625}, 3.75, 3.75));
   for (size_t index = 0; index < 24; ++index) {
     const float width = 0.375;
-    objects.push_back(
-        makeStaticObject({{18.625 + width * index, -8.0}, {18.625 + width * index, -8.125}}));
+    level.push_back({{18.625 + width * index, -8.0}, {18.625 + width * index, -8.125}});
   }
 
-  objects.push_back(makeStaticObject({{18, 2}, {23, -3.0}, {27, 2}})); /* Plattform. */
-
-  objects.push_back(
-      makeStaticObject({{11.25, -19.5}, {16.25, -19.5}, {19.875, -15.75}}));         /* Ramp. */
-  objects.push_back(makeStaticObject({{0.25, -15.0}, {0.25, -19.5}, {8.5, -19.5}})); /* Ramp. */
-  objects.push_back(
-      makeStaticObject({{18.75, -11.75}, {19.75, -13.0}, {15.5, -11.75}})); /* Plattform. */
-  objects.push_back(
-      makeStaticObject({{13.75, -8.0}, {14.75, -9.25}, {10.5, -8.0}})); /* Plattform. */
-  objects.push_back(
-      makeStaticObject({{28.75, -19.5}, {31.75, -19.5}, {31.75, -11.75}})); /* Steep ramp. */
+  level.push_back({{18, 2}, {23, -3.0}, {27, 2}});                     /* Plattform. */
+  level.push_back({{11.25, -19.5}, {16.25, -19.5}, {19.875, -15.75}}); /* Ramp. */
+  level.push_back({{0.25, -15.0}, {0.25, -19.5}, {8.5, -19.5}});       /* Ramp. */
+  level.push_back({{18.75, -11.75}, {19.75, -13.0}, {15.5, -11.75}});  /* Plattform. */
+  level.push_back({{13.75, -8.0}, {14.75, -9.25}, {10.5, -8.0}});      /* Plattform. */
+  level.push_back({{28.75, -19.5}, {31.75, -19.5}, {31.75, -11.75}});  /* Steep ramp. */
+  objects.push_back(&level_geometry.emplace(level));
 }
 
-Physics::JumpAndRunObject &Game::getGameCharacter() {
-  return *dynamic_cast<Physics::JumpAndRunObject *>(objects.front().get());
+void Game::reset() {
+  objects.clear();
+  characters.clear();
+  static_boxes.clear();
+  dynamic_boxes.clear();
+  level_geometry.reset();
+
+  camera = Camera{screen_width, screen_height};
+  camera_zoom = 1;
+  camera_orientation = 0;
+  /* The new level reuses the slots of the cleared pools. A fresh integrator doesn't know their
+   * previous objects, so none of them need to be invalidated. */
+  const auto worker_count = integrator.getWorkerCount();
+  integrator = Physics::Integrator{};
+  integrator.setWorkerCount(worker_count);
+  createLevel();
 }
 
+Physics::JumpAndRunObject &Game::getGameCharacter() { return *characters.get(game_character); }
+
 const Physics::JumpAndRunObject &Game::getGameCharacter() const {
-  return *dynamic_cast<Physics::JumpAndRunObject *>(objects.front().get());
+  return *characters.get(game_character);
 }
 
 void Game::addStaticBox(const glm::vec2 screen_position) {
-  objects.push_back(
-      makeBox<Physics::StaticObject>(camera.toWorldCoordinate(screen_position), 0.5, 0.5));
+  addStaticBoxInWorld(toWorldCoordinate(screen_position));
 }
 
 void Game::addDynamicBox(const glm::vec2 screen_position) {
-  objects.push_back(
-      makeBox<Physics::DynamicObject>(camera.toWorldCoordinate(screen_position), 0.5, 0.5));
+  addDynamicBoxInWorld(toWorldCoordinate(screen_position));
+}
+
+void Game::addStaticBoxInWorld(const glm::vec2 world_position) {
+  objects.push_back(static_boxes.get(createBox(static_boxes, world_position, 0.5, 0.5)));
+}
+
+void Game::addDynamicBoxInWorld(const glm::vec2 world_position) {
+  objects.push_back(dynamic_boxes.get(createBox(dynamic_boxes, world_position, 0.5, 0.5)));
+}
+
+glm::vec2 Game::toWorldCoordinate(const glm::vec2 screen_position) const {
+  return camera.toWorldCoordinate(screen_position);
+}
+
+void Game::addDynamicBoxRows(const size_t box_count) {
+  const size_t boxes_per_row = 40;
+  for (size_t index = 0; index < box_count; ++index) {
+    const auto column = static_cast<float>(index % boxes_per_row);
+    const auto row = static_cast<float>(index / boxes_per_row);
+    addDynamicBoxInWorld({1 + column * 0.75f, 5 + row * 0.75f});
+  }
 }
 
 void Game::integratePhysics(const std::chrono::microseconds time_since_last_tick) {
@@ -77,6 +130,19 @@ void Game::integratePhysics(const std::chrono::microseconds time_since_last_tick
   camera.stepTowardsPosition(getGameCharacter().getBoundingPolygon().getPosition());
 }
 
+Physics::Integrator &Game::getIntegrator() { return integrator; }
+
+const std::vector<Physics::Object *> &Game::getObjects() const { return objects; }
+
+uint64_t Game::computeStateHash() const {
+  uint64_t hash = 14695981039346656037ull;
+  for (const auto &object : objects) {
+    hash = combineHash(hash, object->getBoundingPolygon().getPosition());
+    hash = combineHash(hash, object->getVelocity());
+  }
+  return hash;
+}
+
 void Game::rotateCamera(float angle) {
   camera_orientation += angle;
   camera.setOrientation(camera_orientation);
@@ -88,8 +154,18 @@ void Game::scaleCamera(float scaling_factor) {
 }
 
 void Game::render(SDL_Renderer *renderer) const {
-  for (const auto &object : objects) {
-    object->render(renderer, camera, integrator.getRendererInterpolationValue());
+  /* Objects are rendered between their previous and current position, which is not covered by
+   * the bounding boxes known to the integrator. Fast objects are not limited in speed, so the
+   * margin depends on the last tick. */
+  const glm::vec2 margin{integrator.getLargestMotion()};
+  auto visible_area = camera.getVisibleArea();
+  visible_area.min -= margin;
+  visible_area.max += margin;
+
+  integrator.queryArea(visible_area, visible_objects);
+  for (const auto index : visible_objects) {
+    objects[index]->render(line_batch, camera, integrator.getRendererInterpolationValue());
   }
+  line_batch.render(renderer);
 }
 } // namespace GameEngine
@@ -6,11 +6,17 @@
 #define GAME_ENGINE_SRC_GAME_HPP
 
 #include "GameEngine/Camera.hpp"
+#include "GameEngine/LineBatch.hpp"
+#include "GameEngine/ObjectPool.hpp"
+#include "GameEngine/Physics/DynamicObject.hpp"
 #include "GameEngine/Physics/Integrator.hpp"
 #include "GameEngine/Physics/JumpAndRunObject.hpp"
 #include "GameEngine/Physics/Object.hpp"
+#include "GameEngine/Physics/StaticGeometry.hpp"
+#include "GameEngine/Physics/StaticObject.hpp"
 #include <SDL_render.h>
-#include <memory>
+#include <cstdint>
+#include <optional>
 #include <vector>
 
 namespace GameEngine {
@@ -18,23 +24,63 @@ class Game {
 public:
   Game(size_t screen_width, size_t screen_height);
 
+  /** The object list points into the pools and the level geometry of this instance. */
+  Game(const Game &) = delete;
+  Game(Game &&) = delete;
+  Game &operator=(const Game &) = delete;
+  Game &operator=(Game &&) = delete;
+
+  /** Restore the initial level. Keeps the worker count of the integrator and the memory of all
+   * objects for reuse. */
+  void reset();
+
   Physics::JumpAndRunObject &getGameCharacter();
   const Physics::JumpAndRunObject &getGameCharacter() const;
   void addStaticBox(glm::vec2 screen_position);
   void addDynamicBox(glm::vec2 screen_position);
+  void addStaticBoxInWorld(glm::vec2 world_position);
+  void addDynamicBoxInWorld(glm::vec2 world_position);
+  glm::vec2 toWorldCoordinate(glm::vec2 screen_position) const;
+
+  /** Fill the space above the level with rows of dynamic boxes. Used for load testing. */
+  void addDynamicBoxRows(size_t box_count);
   void integratePhysics(std::chrono::microseconds time_since_last_tick);
+  Physics::Integrator &getIntegrator();
+  const std::vector<Physics::Object *> &getObjects() const;
+
+  /** @return Hash of the positions and velocities of all objects. Two games which processed the
+   * same input in the same ticks have the same hash. */
+  uint64_t computeStateHash() const;
 
   void rotateCamera(float angle);
   void scaleCamera(float scaling_factor);
   void render(SDL_Renderer *renderer) const;
 
 private:
+  size_t screen_width;
+  size_t screen_height;
   Camera camera;
   float camera_zoom = 1;
   float camera_orientation = 0;
 
   Physics::Integrator integrator;
-  std::vector<std::unique_ptr<Physics::Object>> objects;
+
+  /** Reused for each frame to avoid allocations. */
+  mutable LineBatch line_batch;
+  mutable std::vector<size_t> visible_objects;
+
+  /** Own all objects of the level. */
+  ObjectPool<Physics::JumpAndRunObject> characters;
+  ObjectPool<Physics::StaticObject> static_boxes;
+  ObjectPool<Physics::DynamicObject> dynamic_boxes;
+  std::optional<Physics::StaticGeometry> level_geometry;
+
+  ObjectPool<Physics::JumpAndRunObject>::Handle game_character;
+
+  /** Contains all objects in the order in which they were added. */
+  std::vector<Physics::Object *> objects;
+
+  void createLevel();
 };
 } // namespace GameEngine
 
@@ -0,0 +1,275 @@
+/** @file
+ * Runs the demo game without window, renderer or frame limit. Drives the game character from a
+ * script or a recorded session and prints the final state of all objects as JSON.
+ *
+ * Usage: Headless [--ticks N] [--boxes N] [--workers N] [--script FILE] [--replay FILE]
+ *                 [--record FILE]
+ *
+ * Each line of the script contains a tick number followed by a command, which will be executed
+ * before the given tick. Empty lines and lines starting with # are ignored. Commands:
+ *
+ *   run left|right|stop
+ *   jump
+ *   static_box X Y
+ *   dynamic_box X Y
+ *   reset
+ *
+ * --replay feeds the input of a session recorded by the Demo or by --record into the game and
+ * verifies the recorded state hashes. Stops with an error at the first mismatch. Runs until the
+ * last recorded tick unless --ticks is given. Replays must use the same --boxes value and must be
+ * either both serial or both parallel, see Physics::Integrator::setWorkerCount().
+ *
+ * --record writes all executed input and the state hash after each tick to the given file.
+ */
+
+#include "Game.hpp"
+#include "GameEngine/Physics/Integrator.hpp"
+#include "InputLog.hpp"
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace GameEngine;
+
+namespace {
+const size_t screen_width = 1280;
+const size_t screen_height = 800;
+
+/** Upper limits of the numeric options. Catch typos which would otherwise run practically forever
+ * or exhaust the memory. Replays are bounded by the same tick limit, see readInputLog(). */
+const size_t ticks_max = input_log_tick_max;
+const size_t boxes_max = 1'000'000;
+const size_t workers_max = 256;
+
+struct Options {
+  /** Defaults to 600 or to the length of the replayed session. */
+  std::optional<size_t> ticks;
+
+  /** Amount of dynamic boxes to spawn into the level before the first tick. */
+  size_t boxes = 0;
+
+  size_t workers = 0;
+
+  /** Input from a script or a replayed session. Empty state hashes if not replaying. */
+  InputLog input;
+
+  /** Empty if nothing should be recorded. */
+  std::string record_path;
+};
+
+std::runtime_error makeScriptError(const size_t line_number, const std::string_view message) {
+  return std::runtime_error{"Script line " + std::to_string(line_number) + ": " +
+                            std::string{message}};
+}
+
+std::vector<InputEvent> parseScript(std::istream &stream) {
+  std::vector<InputEvent> events;
+  std::string line;
+  for (size_t line_number = 1; std::getline(stream, line); ++line_number) {
+    const auto first_character = line.find_first_not_of(" \t\r");
+    if (first_character == std::string::npos || line[first_character] == '#') {
+      continue;
+    }
+
+    std::istringstream line_stream{line};
+    InputEvent event{};
+    std::string name;
+    if (!(line_stream >> event.tick >> name)) {
+      throw makeScriptError(line_number, "expected tick number and command");
+    }
+    if (name == "run") {
+      std::string direction;
+      line_stream >> direction;
+      if (direction == "left") {
+        event.command = InputCommand::RunLeft;
+      } else if (direction == "right") {
+        event.command = InputCommand::RunRight;
+      } else if (direction == "stop") {
+        event.command = InputCommand::StopRunning;
+      } else {
+        throw makeScriptError(line_number, "expected left, right or stop");
+      }
+    } else if (name == "static_box" || name == "dynamic_box") {
+      event.command =
+          name == "static_box" ? InputCommand::AddStaticBox : InputCommand::AddDynamicBox;
+      if (!(line_stream >> event.world_position.x >> event.world_position.y)) {
+        throw makeScriptError(line_number, "expected world position");
+      }
+    } else if (name == "jump") {
+      event.command = InputCommand::Jump;
+    } else if (name == "reset") {
+      event.command = InputCommand::Reset;
+    } else {
+      throw makeScriptError(line_number, "unknown command \"" + name + "\"");
+    }
+    events.push_back(event);
+  }
+
+  std::stable_sort(events.begin(), events.end(),
+                   [](const InputEvent &a, const InputEvent &b) { return a.tick < b.tick; });
+  return events;
+}
+
+/** @return Amount of ticks needed to process all events and reach all state hashes. */
+size_t getLength(const InputLog &log) {
+  size_t length = 0;
+  if (!log.events.empty()) {
+    length = log.events.back().tick + 1;
+  }
+  if (!log.state_hashes.empty()) {
+    length = std::max<size_t>(length, log.state_hashes.back().tick);
+  }
+  return length;
+}
+
+/** @return The given value of the given option. */
+const char *requireValue(const std::string_view option, const char *value) {
+  if (value == nullptr) {
+    throw std::runtime_error{"Missing value for " + std::string{option}};
+  }
+  return value;
+}
+
+/** @return The given value of the given option as a whole number between 0 and the given
+ * maximum. */
+size_t parseCount(const std::string_view option, const char *value, const size_t maximum) {
+  const std::string_view text = requireValue(option, value);
+  size_t count = 0;
+  const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), count);
+  if (error != std::errc{} || end != text.data() + text.size() || count > maximum) {
+    throw std::runtime_error{"Invalid value for " + std::string{option} +
+                             ": expected a number between 0 and " + std::to_string(maximum)};
+  }
+  return count;
+}
+
+Options parseOptions(const int argc, char *argv[]) {
+  Options options{};
+  for (int index = 1; index < argc; ++index) {
+    const std::string_view option = argv[index];
+    const char *value = index + 1 < argc ? argv[index + 1] : nullptr;
+    if (option == "--ticks") {
+      options.ticks = parseCount(option, value, ticks_max);
+    } else if (option == "--boxes") {
+      options.boxes = parseCount(option, value, boxes_max);
+    } else if (option == "--workers") {
+      options.workers = parseCount(option, value, workers_max);
+    } else if (option == "--script") {
+      std::ifstream file{requireValue(option, value)};
+      if (!file) {
+        throw std::runtime_error{"Failed to open script"};
+      }
+      options.input = InputLog{parseScript(file), {}};
+    } else if (option == "--replay") {
+      std::ifstream file{requireValue(option, value), std::ios::binary};
+      if (!file) {
+        throw std::runtime_error{"Failed to open replay"};
+      }
+      options.input = readInputLog(file);
+    } else if (option == "--record") {
+      options.record_path = requireValue(option, value);
+    } else {
+      throw std::runtime_error{"Unknown option " + std::string{option}};
+    }
+    ++index;
+  }
+  return options;
+}
+
+void printJson(const Game &game, const size_t ticks, const std::chrono::duration<double> duration,
+               const size_t verified_state_hashes) {
+  /* Runs shorter than a tick of the clock can't be measured, and JSON has no infinity. */
+  std::ostringstream ticks_per_second;
+  if (duration.count() > 0) {
+    ticks_per_second << ticks / duration.count();
+  } else {
+    ticks_per_second << "null";
+  }
+
+  std::cout << "{\n  \"ticks\": " << ticks << ",\n  \"seconds\": " << duration.count()
+            << ",\n  \"ticks_per_second\": " << ticks_per_second.str()
+            << ",\n  \"state_hash\": " << game.computeStateHash()
+            << ",\n  \"verified_state_hashes\": " << verified_state_hashes << ",\n  \"objects\": [";
+  const auto &objects = game.getObjects();
+  for (size_t index = 0; index < objects.size(); ++index) {
+    const auto &object = *objects[index];
+    const auto position = object.getBoundingPolygon().getPosition();
+    const auto velocity = object.getVelocity();
+    std::cout << (index == 0 ? "\n" : ",\n") << "    {\"position\": [" << position.x << ", "
+              << position.y << "], \"velocity\": [" << velocity.x << ", " << velocity.y
+              << "], \"static\": " << std::boolalpha
+              << (object.getBodyType() == Physics::BodyType::Static)
+              << ", \"sleeping\": " << object.isSleeping() << "}";
+  }
+  std::cout << "\n  ]\n}" << std::endl;
+}
+} // namespace
+
+int main(int argc, char *argv[]) {
+  try {
+    const auto options = parseOptions(argc, argv);
+    const auto ticks = options.ticks.value_or(
+        options.input.state_hashes.empty() ? 600 : getLength(options.input));
+    Game game{screen_width, screen_height};
+    game.getIntegrator().setWorkerCount(options.workers);
+    game.addDynamicBoxRows(options.boxes);
+
+    std::ofstream record_file;
+    std::optional<InputLogWriter> recorder;
+    if (!options.record_path.empty()) {
+      record_file.open(options.record_path, std::ios::binary);
+      if (!record_file) {
+        throw std::runtime_error{"Failed to open " + options.record_path};
+      }
+      recorder.emplace(record_file);
+    }
+
+    auto next_event = options.input.events.cbegin();
+    auto next_state_hash = options.input.state_hashes.cbegin();
+    size_t verified_state_hashes = 0;
+    const auto verify_state_hashes = [&](const uint64_t processed_ticks) {
+      const auto end = options.input.state_hashes.cend();
+      for (; next_state_hash != end && next_state_hash->tick <= processed_ticks;
+           ++next_state_hash) {
+        if (next_state_hash->tick < processed_ticks) {
+          continue;
+        }
+        if (next_state_hash->value != game.computeStateHash()) {
+          throw std::runtime_error{"State hash mismatch after tick " +
+                                   std::to_string(processed_ticks)};
+        }
+        ++verified_state_hashes;
+      }
+    };
+
+    verify_state_hashes(0);
+    const auto start_time = std::chrono::steady_clock::now();
+    for (size_t tick = 0; tick < ticks; ++tick) {
+      for (; next_event != options.input.events.cend() && next_event->tick <= tick; ++next_event) {
+        applyInput(game, *next_event);
+        if (recorder) {
+          recorder->write(InputEvent{tick, next_event->command, next_event->world_position});
+        }
+      }
+      game.integratePhysics(Physics::Integrator::getTickDuration());
+      verify_state_hashes(tick + 1);
+      if (recorder) {
+        recorder->write(StateHash{tick + 1, game.computeStateHash()});
+      }
+    }
+    const auto duration = std::chrono::steady_clock::now() - start_time;
+
+    printJson(game, ticks, duration, verified_state_hashes);
+  } catch (const std::exception &error) {
+    std::cerr << error.what() << std::endl;
+    return 1;
+  }
+}
@@ -0,0 +1,151 @@
+/** @file
+ * Implements recording and replaying of game sessions. All values are stored in little-endian
+ * byte order.
+ */
+
+#include "InputLog.hpp"
+#include <array>
+#include <cstring>
+#include <stdexcept>
+
+using namespace GameEngine;
+
+namespace {
+constexpr std::array<char, 4> magic_number{'G', 'E', 'I', 'L'};
+constexpr uint8_t format_version = 1;
+
+/** Record type of state hashes. All other record types are InputCommand values. */
+constexpr uint8_t state_hash_record = 0xff;
+
+void writeInteger(std::ostream &stream, const uint64_t value, const size_t byte_count) {
+  for (size_t index = 0; index < byte_count; ++index) {
+    stream.put(static_cast<char>((value >> (index * 8)) & 0xff));
+  }
+}
+
+void writeFloat(std::ostream &stream, const float value) {
+  uint32_t bits = 0;
+  std::memcpy(&bits, &value, sizeof(bits));
+  writeInteger(stream, bits, sizeof(bits));
+}
+
+std::runtime_error makeCorruptLogError() {
+  return std::runtime_error{"Input log is corrupt or truncated"};
+}
+
+std::runtime_error makeUnsortedLogError() {
+  return std::runtime_error{"Input log is not sorted by tick"};
+}
+
+uint64_t readInteger(std::istream &stream, const size_t byte_count) {
+  uint64_t value = 0;
+  for (size_t index = 0; index < byte_count; ++index) {
+    const auto byte = stream.get();
+    if (byte == std::istream::traits_type::eof()) {
+      throw makeCorruptLogError();
+    }
+    value |= static_cast<uint64_t>(byte) << (index * 8);
+  }
+  return value;
+}
+
+float readFloat(std::istream &stream) {
+  const auto bits = static_cast<uint32_t>(readInteger(stream, sizeof(uint32_t)));
+  float value = 0;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+bool hasWorldPosition(const InputCommand command) {
+  return command == InputCommand::AddStaticBox || command == InputCommand::AddDynamicBox;
+}
+} // namespace
+
+namespace GameEngine {
+void applyInput(Game &game, const InputEvent &event) {
+  switch (event.command) {
+  case InputCommand::RunLeft:
+    game.getGameCharacter().run(HorizontalDirection::Left);
+    break;
+  case InputCommand::RunRight:
+    game.getGameCharacter().run(HorizontalDirection::Right);
+    break;
+  case InputCommand::StopRunning:
+    game.getGameCharacter().run(std::nullopt);
+    break;
+  case InputCommand::Jump:
+    game.getGameCharacter().jump();
+    break;
+  case InputCommand::AddStaticBox:
+    game.addStaticBoxInWorld(event.world_position);
+    break;
+  case InputCommand::AddDynamicBox:
+    game.addDynamicBoxInWorld(event.world_position);
+    break;
+  case InputCommand::Reset:
+    game.reset();
+    break;
+  }
+}
+
+InputLogWriter::InputLogWriter(std::ostream &stream) : stream{stream} {
+  stream.write(magic_number.data(), magic_number.size());
+  writeInteger(stream, format_version, 1);
+}
+
+void InputLogWriter::write(const InputEvent &event) {
+  writeInteger(stream, static_cast<uint8_t>(event.command), 1);
+  writeInteger(stream, event.tick, sizeof(event.tick));
+  if (hasWorldPosition(event.command)) {
+    writeFloat(stream, event.world_position.x);
+    writeFloat(stream, event.world_position.y);
+  }
+}
+
+void InputLogWriter::write(const StateHash &state_hash) {
+  writeInteger(stream, state_hash_record, 1);
+  writeInteger(stream, state_hash.tick, sizeof(state_hash.tick));
+  writeInteger(stream, state_hash.value, sizeof(state_hash.value));
+}
+
+InputLog readInputLog(std::istream &stream) {
+  std::array<char, magic_number.size()> header{};
+  stream.read(header.data(), header.size());
+  if (!stream || header != magic_number) {
+    throw std::runtime_error{"Not an input log"};
+  }
+  if (readInteger(stream, 1) != format_version) {
+    throw std::runtime_error{"Unsupported input log version"};
+  }
+
+  InputLog log;
+  for (auto type = stream.get(); type != std::istream::traits_type::eof(); type = stream.get()) {
+    const auto tick = readInteger(stream, sizeof(uint64_t));
+    if (tick > input_log_tick_max) {
+      throw std::runtime_error{"Input log exceeds the maximal replay length"};
+    }
+    if (type == state_hash_record) {
+      if (!log.state_hashes.empty() && tick < log.state_hashes.back().tick) {
+        throw makeUnsortedLogError();
+      }
+      log.state_hashes.push_back({tick, readInteger(stream, sizeof(uint64_t))});
+      continue;
+    }
+    if (type > static_cast<uint8_t>(InputCommand::Reset)) {
+      throw makeCorruptLogError();
+    }
+
+    if (!log.events.empty() && tick < log.events.back().tick) {
+      throw makeUnsortedLogError();
+    }
+
+    InputEvent event{tick, static_cast<InputCommand>(type)};
+    if (hasWorldPosition(event.command)) {
+      event.world_position.x = readFloat(stream);
+      event.world_position.y = readFloat(stream);
+    }
+    log.events.push_back(event);
+  }
+  return log;
+}
+} // namespace GameEngine
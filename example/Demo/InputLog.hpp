@@ -0,0 +1,82 @@
+/** @file
+ * Contains helpers for recording and replaying the input of a game session.
+ */
+
+#ifndef GAME_ENGINE_SRC_INPUT_LOG_HPP
+#define GAME_ENGINE_SRC_INPUT_LOG_HPP
+
+#include "Game.hpp"
+#include <cstdint>
+#include <glm/vec2.hpp>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+namespace GameEngine {
+/** All ways in which a player can influence the game. */
+enum class InputCommand : uint8_t {
+  RunLeft,
+  RunRight,
+  StopRunning,
+  Jump,
+  AddStaticBox,
+  AddDynamicBox,
+  Reset,
+};
+
+struct InputEvent {
+  /** Amount of ticks processed since the start of the session when the command was issued. The
+   * command gets executed before the next tick. */
+  uint64_t tick;
+
+  InputCommand command;
+
+  /** Used by AddStaticBox and AddDynamicBox. Stored in world coordinates to make replays
+   * independent of the camera. */
+  glm::vec2 world_position{};
+};
+
+/** Fingerprint of the game state after the given amount of ticks. See Game::computeStateHash(). */
+struct StateHash {
+  uint64_t tick;
+  uint64_t value;
+};
+
+/** Contents of a recorded session. Both lists are sorted by tick. */
+struct InputLog {
+  std::vector<InputEvent> events;
+  std::vector<StateHash> state_hashes;
+};
+
+/** Execute the given events command on the given game. */
+void applyInput(Game &game, const InputEvent &event);
+
+/** Writes a compact binary log of input events and state hashes. Records must be written in the
+ * order of their ticks. */
+class InputLogWriter {
+public:
+  /** @param stream Binary stream to write the log to. Must outlive the writer. */
+  explicit InputLogWriter(std::ostream &stream);
+
+  void write(const InputEvent &event);
+  void write(const StateHash &state_hash);
+
+private:
+  std::ostream &stream;
+};
+
+/** Largest tick accepted by readInputLog(). Bounds the length of replays read from corrupt logs.
+ * Corresponds to almost 20 days of gameplay at 60 ticks per second. */
+constexpr uint64_t input_log_tick_max = 100'000'000;
+
+/** Read a log created by InputLogWriter.
+ *
+ * @param stream Binary stream containing the log.
+ *
+ * @return All records of the given log. Throws std::runtime_error if the log is invalid, including
+ * logs with records not sorted by tick or with ticks larger than input_log_tick_max.
+ */
+InputLog readInputLog(std::istream &stream);
+} // namespace GameEngine
+
+#endif
@@ -1,14 +1,25 @@
 /** @file
  * Main playground for testing code.
+ *
+ * Usage: Demo [--record FILE]
+ *
+ * --record writes all input and periodic state hashes to the given file. The session can be
+ * replayed at unlimited speed using the Headless executable.
  */
 
 #include "Game.hpp"
 #include "GameEngine/SDL2/Error.hpp"
 #include "GameEngine/SDL2/UniquePointer.hpp"
+#include "InputLog.hpp"
+#include "StatisticsOverlay.hpp"
 #include <SDL.h>
 #include <chrono>
+#include <fstream>
 #include <iostream>
 #include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
 #include <string_view>
 #include <thread>
 #include <utility>
@@ -29,9 +40,42 @@ auto makeWindowAndRenderer() {
   }
   return std::pair{SDL2::wrapPointer(window), SDL2::wrapPointer(renderer)};
 }
+
+/** @return Path passed via --record. Empty if no recording was requested. */
+std::string parseRecordPath(const int argc, char *argv[]) {
+  std::string record_path;
+  for (int index = 1; index < argc; ++index) {
+    const std::string_view option = argv[index];
+    if (option != "--record") {
+      throw std::runtime_error{"Unknown option " + std::string{option}};
+    }
+    if (index + 1 >= argc) {
+      throw std::runtime_error{"Missing value for --record"};
+    }
+    record_path = argv[index + 1];
+    ++index;
+  }
+  return record_path;
+}
 } // namespace
 
-int main() {
+int main(int argc, char *argv[]) {
+  std::ofstream record_file;
+  std::optional<InputLogWriter> recorder;
+  try {
+    const auto record_path = parseRecordPath(argc, argv);
+    if (!record_path.empty()) {
+      record_file.open(record_path, std::ios::binary);
+      if (!record_file) {
+        throw std::runtime_error{"Failed to open " + record_path};
+      }
+      recorder.emplace(record_file);
+    }
+  } catch (const std::exception &error) {
+    std::cerr << error.what() << std::endl;
+    return 1;
+  }
+
   struct Context {
     Context() {
       if (SDL_Init(SDL_INIT_EVERYTHING) != 0) {
@@ -47,6 +91,23 @@ int main() {
   const auto *buttons = SDL_GetKeyboardState(nullptr);
 
   Game game{screen_width, screen_height};
+  StatisticsOverlay statistics_overlay{screen_height};
+  bool statistics_visible = false;
+  size_t frame_count = 0;
+
+  /* Ticks processed since the start of the session, including ticks before resets. */
+  uint64_t session_tick = 0;
+  auto run_command = InputCommand::StopRunning;
+  const auto submit = [&](const InputCommand command, const glm::vec2 world_position = {}) {
+    const InputEvent event{session_tick, command, world_position};
+    applyInput(game, event);
+    if (recorder) {
+      recorder->write(event);
+    }
+    if (command == InputCommand::Reset) {
+      run_command = InputCommand::StopRunning;
+    }
+  };
 
   while (program_running) {
     const auto frame_start_time = std::chrono::steady_clock::now();
@@ -59,15 +120,19 @@ int main() {
       }
       if (event.type == SDL_KEYDOWN) {
         if (event.key.keysym.sym == SDLK_UP) {
-          game.getGameCharacter().jump();
+          submit(InputCommand::Jump);
         } else if (event.key.keysym.sym == SDLK_r) {
-          game = Game{screen_width, screen_height};
+          submit(InputCommand::Reset);
+        } else if (event.key.keysym.sym == SDLK_F3) {
+          statistics_visible = !statistics_visible;
+          SDL_SetWindowTitle(window.get(), "");
         }
       } else if (event.type == SDL_MOUSEBUTTONDOWN) {
+        const auto world_position = game.toWorldCoordinate({event.button.x, event.button.y});
         if (event.button.button == SDL_BUTTON_LEFT) {
-          game.addStaticBox({event.button.x, event.button.y});
+          submit(InputCommand::AddStaticBox, world_position);
         } else if (event.button.button == SDL_BUTTON_RIGHT) {
-          game.addDynamicBox({event.button.x, event.button.y});
+          submit(InputCommand::AddDynamicBox, world_position);
         }
       } else if (event.type == SDL_MOUSEWHEEL) {
         if (buttons[SDL_SCANCODE_LCTRL]) {
@@ -78,19 +143,38 @@ int main() {
       }
     }
 
+    auto pressed_run_command = InputCommand::StopRunning;
     if (buttons[SDL_SCANCODE_LEFT]) {
-      game.getGameCharacter().run(HorizontalDirection::Left);
+      pressed_run_command = InputCommand::RunLeft;
     } else if (buttons[SDL_SCANCODE_RIGHT]) {
-      game.getGameCharacter().run(HorizontalDirection::Right);
-    } else {
-      game.getGameCharacter().run(std::nullopt);
+      pressed_run_command = InputCommand::RunRight;
+    }
+    if (pressed_run_command != run_command) {
+      run_command = pressed_run_command;
+      submit(run_command);
     }
 
+    const auto tick_count_before_frame = game.getIntegrator().getTickCount();
     game.integratePhysics(duration_of_last_frame);
+    const auto ticks_processed = game.getIntegrator().getTickCount() - tick_count_before_frame;
+    session_tick += ticks_processed;
+    if (recorder && ticks_processed > 0) {
+      recorder->write(StateHash{session_tick, game.computeStateHash()});
+    }
+    statistics_overlay.add(game.getIntegrator().getStatistics());
 
     SDL_SetRenderDrawColor(renderer.get(), 0, 0, 0, 255);
     SDL_RenderClear(renderer.get());
     game.render(renderer.get());
+    if (statistics_visible) {
+      statistics_overlay.render(renderer.get());
+
+      /* SDL can't render text, so the counters are shown in the window title. */
+      if (frame_count % 30 == 0) {
+        SDL_SetWindowTitle(window.get(), statistics_overlay.getSummary().c_str());
+      }
+    }
+    ++frame_count;
     SDL_RenderPresent(renderer.get());
 
     const auto frame_duration = std::chrono::steady_clock::now() - frame_start_time;
@@ -0,0 +1,71 @@
+/** @file
+ * Implements an overlay visualizing the work done by the physics integrator.
+ */
+
+#include "StatisticsOverlay.hpp"
+#include <chrono>
+#include <sstream>
+
+using namespace GameEngine;
+using namespace std::chrono_literals;
+
+namespace {
+constexpr size_t frames_shown = 240;
+
+/** Height of the bars in pixels per millisecond. */
+constexpr float pixels_per_millisecond = 6;
+
+constexpr float margin = 10;
+
+float toPixels(const std::chrono::nanoseconds duration) {
+  return std::chrono::duration<float, std::milli>{duration}.count() * pixels_per_millisecond;
+}
+} // namespace
+
+namespace GameEngine {
+StatisticsOverlay::StatisticsOverlay(const size_t screen_height)
+    : origin{margin, screen_height - margin}, frames(frames_shown) {}
+
+void StatisticsOverlay::add(const Physics::Integrator::Statistics &statistics) {
+  frames[next_frame] = statistics;
+  next_frame = (next_frame + 1) % frames.size();
+}
+
+void StatisticsOverlay::render(SDL_Renderer *renderer) const {
+  /* Oldest frame on the left, latest frame on the right. */
+  for (size_t offset = 0; offset < frames.size(); ++offset) {
+    const auto &frame = frames[(next_frame + offset) % frames.size()];
+    const glm::vec2 bottom = origin + glm::vec2{offset, 0};
+    const glm::vec2 update_top = bottom - glm::vec2{0, toPixels(frame.update_time)};
+    const glm::vec2 collision_top = update_top - glm::vec2{0, toPixels(frame.collision_time)};
+    line_batch.setColor({255, 200, 0, 255});
+    line_batch.addLine(bottom, update_top);
+    line_batch.setColor({255, 60, 60, 255});
+    line_batch.addLine(update_top, collision_top);
+  }
+
+  /* Time available for each frame at 60 frames per second. */
+  const glm::vec2 budget_offset{0, toPixels(std::chrono::microseconds{1s} / 60)};
+  line_batch.setColor({255, 255, 255, 255});
+  line_batch.addLine(origin - budget_offset,
+                     origin - budget_offset + glm::vec2{frames.size(), 0});
+  line_batch.render(renderer);
+}
+
+std::string StatisticsOverlay::getSummary() const {
+  if (!Physics::Integrator::isStatisticsEnabled()) {
+    return "Physics statistics disabled, build with GAME_ENGINE_ENABLE_STATISTICS";
+  }
+
+  const auto &frame = frames[(next_frame + frames.size() - 1) % frames.size()];
+  std::ostringstream stream;
+  stream << "ticks " << frame.ticks << " | substeps " << frame.substeps << " | narrowphase "
+         << frame.narrowphase_tests << " | collisions " << frame.collisions << " | unprocessed "
+         << frame.unprocessed_object_iterations << " | dropped " << frame.dropped_motions
+         << " | update "
+         << std::chrono::duration<float, std::milli>{frame.update_time}.count()
+         << " ms | collision "
+         << std::chrono::duration<float, std::milli>{frame.collision_time}.count() << " ms";
+  return stream.str();
+}
+} // namespace GameEngine
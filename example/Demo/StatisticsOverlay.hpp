@@ -0,0 +1,42 @@
+/** @file
+ * Contains an overlay visualizing the work done by the physics integrator.
+ */
+
+#ifndef GAME_ENGINE_SRC_STATISTICS_OVERLAY_HPP
+#define GAME_ENGINE_SRC_STATISTICS_OVERLAY_HPP
+
+#include "GameEngine/LineBatch.hpp"
+#include "GameEngine/Physics/Integrator.hpp"
+#include <SDL_render.h>
+#include <string>
+#include <vector>
+
+namespace GameEngine {
+/** Draws the time spent by the integrator during the most recent frames as bar graph in the lower
+ * left corner of the screen. Update time is stacked below collision time. */
+class StatisticsOverlay {
+public:
+  /** @param screen_height Used for placing the overlay at the bottom of the screen. */
+  explicit StatisticsOverlay(size_t screen_height);
+
+  /** @param statistics Work done during the current frame. */
+  void add(const Physics::Integrator::Statistics &statistics);
+
+  void render(SDL_Renderer *renderer) const;
+
+  /** @return Counters of the most recent frame as human readable text. */
+  std::string getSummary() const;
+
+private:
+  glm::vec2 origin;
+
+  /** Ring buffer containing the most recent frames. */
+  std::vector<Physics::Integrator::Statistics> frames;
+  size_t next_frame = 0;
+
+  /** Reused for each frame to avoid allocations. */
+  mutable LineBatch line_batch;
+};
+} // namespace GameEngine
+
+#endif
@@ -5,7 +5,9 @@
 #ifndef GAME_ENGINE_INCLUDE_GAME_ENGINE_CAMERA_HPP
 #define GAME_ENGINE_INCLUDE_GAME_ENGINE_CAMERA_HPP
 
+#include "GameEngine/Geometry.hpp"
 #include <cstddef>
+#include <glm/mat2x2.hpp>
 #include <glm/vec2.hpp>
 
 namespace GameEngine {
@@ -18,10 +20,28 @@ public:
   glm::vec2 toScreenCoordinate(glm::vec2 world_coordinate) const;
   glm::vec2 toWorldCoordinate(glm::vec2 screen_coordinate) const;
 
+  /** Convert multiple world coordinates at once. Cheaper than calling toScreenCoordinate() for
+   * each vertex.
+   *
+   * @param world_coordinates Points to the first of count coordinates.
+   * @param count Amount of coordinates to convert.
+   * @param result Receives count screen coordinates. May be the same as world_coordinates.
+   */
+  void toScreenCoordinates(const glm::vec2 *world_coordinates, size_t count,
+                           glm::vec2 *result) const;
+
+  /** @return Screen coordinates of all given world coordinates, in the same order. */
+  Geometry::VertexList toScreenCoordinates(const Geometry::VertexList &world_coordinates) const;
+
+  /** @return Smallest axis aligned box in the game world containing everything visible on the
+   * screen. Considers zoom and orientation. */
+  Geometry::BoundingBox getVisibleArea() const;
+
   /** @param position New center of the camera in the game world. */
   void setPosition(glm::vec2 position);
 
-  /** @param zoom E.g. 2.0f to zoom in by 2x. Defaults to 1.0f. */
+  /** @param zoom E.g. 2.0f to zoom in by 2x. Defaults to 1.0f. Will be clamped to a small positive
+   * value. */
   void setZoom(float zoom);
 
   /** @param orientation Rotation angle in radians. */
@@ -38,6 +58,15 @@ private:
 
   glm::vec2 center_on_screen;
   glm::vec2 world_to_screen_scaling_factor;
+
+  /* Affine transformation from world to screen coordinates and its inverse. Rebuilt by
+   * updateTransform() whenever position, zoom or orientation change. */
+  glm::mat2 world_to_screen_matrix{1};
+  glm::vec2 world_to_screen_offset{0, 0};
+  glm::mat2 screen_to_world_matrix{1};
+  glm::vec2 screen_to_world_offset{0, 0};
+
+  void updateTransform();
 };
 } // namespace GameEngine
 
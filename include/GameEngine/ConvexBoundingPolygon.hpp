@@ -5,14 +5,21 @@
 #ifndef GAME_ENGINE_INCLUDE_GAME_ENGINE_CONVEX_BOUNDING_POLYGON_HPP
 #define GAME_ENGINE_INCLUDE_GAME_ENGINE_CONVEX_BOUNDING_POLYGON_HPP
 
+#include "GameEngine/Geometry.hpp"
 #include <glm/vec2.hpp>
 #include <optional>
-#include <vector>
 
 namespace GameEngine {
 /** Represents a convex bounding polygon in the game world for collision detection. */
 class ConvexBoundingPolygon {
 public:
+  /** Remembers the axis which separated two polygons during their last collision check. */
+  struct SeparatingAxisHint {
+    /** Index into the separating axes of the polygon on which collidesWith() was called, followed
+     * by the axes of the other polygon. Negative if no separating axis is known. */
+    int axis_index = -1;
+  };
+
   /** Construct a polygon from the given vertices.
    *
    * @param vertices Zero or more points representing a convex polygon in the game world. If no
@@ -20,6 +27,9 @@ public:
    */
   ConvexBoundingPolygon(std::initializer_list<glm::vec2> vertices);
 
+  /** @param vertices Zero or more points representing a convex polygon in the game world. */
+  ConvexBoundingPolygon(const Geometry::VertexList &vertices);
+
   /** @return Center of the object in the game world. */
   glm::vec2 getPosition() const;
 
@@ -63,8 +73,44 @@ public:
    */
   std::optional<glm::vec2> collidesWith(const ConvexBoundingPolygon &other) const;
 
+  /** Same as collidesWith(), but checks the axis which separated both polygons during the previous
+   * call first. Pairs which still don't touch get rejected with a single projection. The result
+   * is always identical to the overload without hint.
+   *
+   * @param other Polygon to check against.
+   * @param hint Result of the previous check between this and the other polygon. Will be updated.
+   * Hints from other pairs or outdated hints are allowed, but make this function slower.
+   */
+  std::optional<glm::vec2> collidesWith(const ConvexBoundingPolygon &other,
+                                        SeparatingAxisHint &hint) const;
+
+  /** Move this polygon along the given motion and find the first moment at which it overlaps the
+   * other polygon by more than the given depth. Uses the separating axis theorem on the swept
+   * polygons, which is exact for translations.
+   *
+   * @param other Polygon which doesn't move.
+   * @param motion Offset by which this polygon moves.
+   * @param penetration_depth Amount by which both polygons are allowed to overlap. Zero finds the
+   * moment at which both polygons start overlapping.
+   *
+   * @return Fraction of the given motion between 0 and 1 after which both polygons overlap by more
+   * than the given depth. 0 if they already do. Nothing if this doesn't happen during the given
+   * motion.
+   */
+  std::optional<float> computeTimeOfImpact(const ConvexBoundingPolygon &other, glm::vec2 motion,
+                                           float penetration_depth = 0) const;
+
+  /** @return Smallest width of this polygon measured across all of its separating axes, which is
+   * the distance between the closest pair of parallel lines enclosing it. Zero for points and
+   * lines. */
+  float computeSmallestExtent() const;
+
   /** @return Vertices of this polygon in the game world. */
-  const std::vector<glm::vec2> &getVertices() const;
+  const Geometry::VertexList &getVertices() const;
+
+  /** @return Smallest axis-aligned box containing all vertices of this polygon. Contains only the
+   * point {0, 0} if this polygon has no vertices. */
+  const Geometry::BoundingBox &getBoundingBox() const;
 
 private:
   /** Center of this object. */
@@ -74,10 +120,20 @@ private:
   float orientation{0.0f};
 
   /** Used for collision detection. */
-  std::vector<glm::vec2> bounding_polygon;
+  Geometry::VertexList bounding_polygon;
 
   /** Used for transformations. */
-  std::vector<glm::vec2> bounding_polygon_relative_to_center;
+  Geometry::VertexList bounding_polygon_relative_to_center;
+
+  /** Used for rejecting collisions early. */
+  Geometry::BoundingBox bounding_box{};
+
+  /** Normalized edge normals used for collision detection. Parallel edges share one axis. Only
+   * depends on the orientation of this polygon, not on its position. */
+  Geometry::VertexList separating_axes;
+
+  /** Separating axes of the polygon at orientation zero. Used for transformations. */
+  Geometry::VertexList separating_axes_relative_to_orientation;
 
   void recomputeBoundingPolygon();
 };
@@ -5,11 +5,82 @@
 #ifndef GAME_ENGINE_INCLUDE_GAME_ENGINE_GEOMETRY_HPP
 #define GAME_ENGINE_INCLUDE_GAME_ENGINE_GEOMETRY_HPP
 
+#include "GameEngine/InlineVector.hpp"
+#include <cstddef>
 #include <functional>
 #include <glm/vec2.hpp>
-#include <vector>
+#include <iterator>
+#include <optional>
+#include <utility>
 
 namespace GameEngine::Geometry {
+/** Vertices of a polygon. Small polygons are stored without heap allocations. */
+using VertexList = InlineVector<glm::vec2, 8>;
+
+/** Axis-aligned rectangle enclosing a set of points. */
+struct BoundingBox {
+  glm::vec2 min; /**< Corner with the smallest coordinates. */
+  glm::vec2 max; /**< Corner with the largest coordinates. */
+};
+
+/** Compute the smallest axis-aligned box containing all vertices of the given polygon.
+ *
+ * @param polygon Contains at least one vertex.
+ *
+ * @return Bounding box of the given polygon.
+ */
+BoundingBox computeBoundingBox(const VertexList &polygon);
+
+/** Check if two bounding boxes overlap. Boxes which only touch each other don't overlap.
+ *
+ * @param a First box to check.
+ * @param b Second box to check.
+ *
+ * @return True if both boxes share a common area.
+ */
+bool overlaps(const BoundingBox &a, const BoundingBox &b);
+
+/** Find the first point at which a line segment touches a bounding box.
+ *
+ * @param start Start of the segment.
+ * @param end End of the segment.
+ * @param bounding_box Box to check against. Its border counts as part of the box.
+ *
+ * @return Position along the segment between 0 (start) and 1 (end) at which the segment enters the
+ * box. 0 if the start lies inside the box. Nothing if the segment misses the box.
+ */
+std::optional<float> intersectSegment(glm::vec2 start, glm::vec2 end,
+                                      const BoundingBox &bounding_box);
+
+/** Same as the bounding box overload, but checks against a convex polygon instead. Polygons with
+ * less than two vertices never get hit.
+ */
+std::optional<float> intersectSegment(glm::vec2 start, glm::vec2 end, const VertexList &polygon);
+
+/** Smallest and largest values found while projecting vertices onto an axis. */
+struct Projection {
+  float min;
+  float max;
+};
+
+/** Contains one projection per axis. */
+using ProjectionList = InlineVector<Projection, 8>;
+
+/** Project all vertices of the given polygon onto each of the given axes. Uses SIMD instructions if
+ * they were enabled at build time.
+ *
+ * @param polygon Contains at least one vertex.
+ * @param axes Normalized axes to project onto.
+ *
+ * @return Projections in the same order as the given axes.
+ */
+ProjectionList projectOntoAxes(const VertexList &polygon, const VertexList &axes);
+
+/** Portable implementation of projectOntoAxes() without SIMD instructions. Produces bit-identical
+ * results.
+ */
+ProjectionList projectOntoAxesScalar(const VertexList &polygon, const VertexList &axes);
+
 /** Count the edges of the given polygon.
  *
  * @param polygon Contains zero or more vertices.
@@ -17,7 +88,7 @@ namespace GameEngine::Geometry {
  * @return Amount of edges in the given polygon. E.g. a triangle with 3 points has 3 edges. A line
  * with 2 points has one edge.
  */
-size_t countEdges(const std::vector<glm::vec2> &polygon);
+size_t countEdges(const VertexList &polygon);
 
 /** Get the edge from the given polygon specified by the edges index.
  *
@@ -27,16 +98,91 @@ size_t countEdges(const std::vector<glm::vec2> &polygon);
  *
  * @return [start, end] positions of the polygons nth edge.
  */
-std::pair<glm::vec2, glm::vec2> getEdge(const std::vector<glm::vec2> &polygon,
-                                        const size_t edge_index);
+std::pair<glm::vec2, glm::vec2> getEdge(const VertexList &polygon, const size_t edge_index);
+
+/** Edges of a polygon, usable in range-based for loops. Yields the same edges in the same order as
+ * getEdge(), but without bounds checks. The polygon must outlive this range and must not be
+ * modified while iterating.
+ */
+class EdgeRange {
+public:
+  /** Yields [start, end] positions of each edge. */
+  class Iterator {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::pair<glm::vec2, glm::vec2>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = value_type;
+
+    Iterator(const glm::vec2 *vertices, const size_t vertex_count, const size_t edge_index)
+        : vertices{vertices}, vertex_count{vertex_count}, edge_index{edge_index} {}
+
+    value_type operator*() const {
+      const auto end_index = edge_index + 1 == vertex_count ? 0 : edge_index + 1;
+      return {vertices[edge_index], vertices[end_index]};
+    }
+
+    Iterator &operator++() {
+      ++edge_index;
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      auto previous = *this;
+      ++edge_index;
+      return previous;
+    }
+
+    bool operator==(const Iterator &other) const { return edge_index == other.edge_index; }
+    bool operator!=(const Iterator &other) const { return edge_index != other.edge_index; }
+
+  private:
+    const glm::vec2 *vertices;
+    size_t vertex_count;
+    size_t edge_index;
+  };
+
+  /** @param polygon Contains zero or more vertices. */
+  explicit EdgeRange(const VertexList &polygon)
+      : vertices{polygon.data()}, vertex_count{polygon.size()},
+        edge_count{polygon.size() < 2 ? 0 : polygon.size() == 2 ? 1 : polygon.size()} {}
+
+  Iterator begin() const { return {vertices, vertex_count, 0}; }
+  Iterator end() const { return {vertices, vertex_count, edge_count}; }
+
+  /** @return Same as countEdges(). */
+  size_t size() const { return edge_count; }
+
+private:
+  const glm::vec2 *vertices;
+  size_t vertex_count;
+  size_t edge_count;
+};
+
+/** @return Range over all edges of the given polygon. See EdgeRange. */
+inline EdgeRange edges(const VertexList &polygon) { return EdgeRange{polygon}; }
+
+/** Apply the given function to all edges of this polygon. Gets inlined completely, prefer this over
+ * the std::function overload in hot paths.
+ *
+ * @param polygon All vertices of the polygon.
+ * @param function Will be called on each edge. Takes the start and end position of the current
+ * edge.
+ */
+template <typename Function> void forEachEdge(const VertexList &polygon, Function &&function) {
+  for (const auto [start, end] : edges(polygon)) {
+    function(start, end);
+  }
+}
 
-/** Apply the given function to all edges of this polygon.
+/** Type-erased version of forEachEdge(). Useful for passing the function across translation units.
  *
  * @param polygon All vertices of the polygon.
  * @param function Will be called on each edge. Takes the start and end position of the current
  * edge.
  */
-void forEachEdge(const std::vector<glm::vec2> &polygon,
+void forEachEdge(const VertexList &polygon,
                  const std::function<void(glm::vec2 edge_start, glm::vec2 edge_end)> &function);
 } // namespace GameEngine::Geometry
 
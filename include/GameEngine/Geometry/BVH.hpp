@@ -0,0 +1,140 @@
+/** @file
+ * Contains a bounding volume hierarchy for searching entries by area, point or line segment.
+ */
+
+#ifndef GAME_ENGINE_INCLUDE_GAME_ENGINE_GEOMETRY_BVH_HPP
+#define GAME_ENGINE_INCLUDE_GAME_ENGINE_GEOMETRY_BVH_HPP
+
+#include "GameEngine/Geometry.hpp"
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace GameEngine::Geometry {
+/** Binary tree of bounding boxes for finding entries which may overlap an area, contain a point or
+ * get hit by a line segment. Entries are identified by their position in the list passed to
+ * build(). Best suited for entries which rarely move, like level geometry. Moving entries can be
+ * updated with refit(), which keeps the structure of the tree and gets slower the further entries
+ * move away from their initial position. Queries don't modify the tree and can run concurrently.
+ */
+class BVH {
+public:
+  struct RaycastHit {
+    size_t index;   /**< Entry which got hit. */
+    float fraction; /**< Position along the segment between 0 (start) and 1 (end). */
+  };
+
+  /** Replace all entries and build a balanced tree.
+   *
+   * @param bounding_boxes Area covered by each entry in the game world. The index of each box
+   * identifies its entry.
+   */
+  void build(const std::vector<BoundingBox> &bounding_boxes);
+
+  /** @return Amount of entries. */
+  size_t size() const;
+
+  /** Update the bounding box of an entry and of all nodes containing it.
+   *
+   * @param index Identifies the entry. Must be smaller than size().
+   * @param bounding_box New area covered by the entry in the game world.
+   */
+  void refit(size_t index, const BoundingBox &bounding_box);
+
+  /** Find all entries overlapping the given area.
+   *
+   * @param area Region in the game world to search in.
+   * @param result Will be cleared and filled with the indices of all entries whose bounding boxes
+   * overlap the given area. See Geometry::overlaps(). Sorted in ascending order.
+   */
+  void queryArea(const BoundingBox &area, std::vector<size_t> &result) const;
+
+  /** Find all entries containing the given point.
+   *
+   * @param point Position in the game world.
+   * @param result Will be cleared and filled with the indices of all entries whose bounding boxes
+   * contain the given point, including their borders. Sorted in ascending order.
+   */
+  void queryPoint(glm::vec2 point, std::vector<size_t> &result) const;
+
+  /** Find the first entry hit by the given line segment. Visits nodes front to back and skips all
+   * nodes behind the closest hit found so far.
+   *
+   * @param start Start of the segment.
+   * @param end End of the segment.
+   * @param intersect Takes the index of an entry whose bounding box gets hit by the segment.
+   * Returns the position along the segment at which the entry itself gets hit, or nothing. E.g. a
+   * call to Geometry::intersectSegment() with the entries polygon.
+   *
+   * @return Closest hit. Nothing if no entry got hit.
+   */
+  template <typename Function>
+  std::optional<RaycastHit> raycast(const glm::vec2 start, const glm::vec2 end,
+                                    Function &&intersect) const {
+    std::optional<RaycastHit> closest_hit;
+    if (!nodes.empty() && intersectSegment(start, end, nodes.front().bounding_box)) {
+      raycastNode(0, start, end, intersect, closest_hit);
+    }
+    return closest_hit;
+  }
+
+private:
+  static constexpr size_t no_node = std::numeric_limits<size_t>::max();
+
+  struct Node {
+    BoundingBox bounding_box; /**< Contains the bounding boxes of all children. */
+    size_t parent;            /**< No parent if this is the root. */
+    size_t left;              /**< No children if this is a leaf. */
+    size_t right;             /**< No children if this is a leaf. */
+    size_t entry;             /**< Only valid for leaves. */
+  };
+
+  /** Contains the root at index 0 if not empty. */
+  std::vector<Node> nodes;
+
+  /** Index of the leaf node of each entry. */
+  std::vector<size_t> leaf_of_entry;
+
+  size_t buildNode(std::vector<size_t> &entries, size_t begin, size_t end, size_t parent,
+                   const std::vector<BoundingBox> &bounding_boxes);
+
+  template <typename Predicate>
+  void collectEntries(const Predicate &node_predicate, std::vector<size_t> &result) const;
+
+  template <typename Function>
+  void raycastNode(const size_t node_index, const glm::vec2 start, const glm::vec2 end,
+                   Function &intersect, std::optional<RaycastHit> &closest_hit) const {
+    const auto &node = nodes[node_index];
+    if (node.left == no_node) {
+      const std::optional<float> fraction = intersect(node.entry);
+      if (fraction && (!closest_hit || *fraction < closest_hit->fraction)) {
+        closest_hit = RaycastHit{node.entry, *fraction};
+      }
+      return;
+    }
+
+    /* Visit the closer child first, which allows skipping the other one more often. */
+    constexpr auto no_hit = std::numeric_limits<float>::infinity();
+    auto near_child = node.left;
+    auto far_child = node.right;
+    auto near_fraction =
+        intersectSegment(start, end, nodes[near_child].bounding_box).value_or(no_hit);
+    auto far_fraction =
+        intersectSegment(start, end, nodes[far_child].bounding_box).value_or(no_hit);
+    if (far_fraction < near_fraction) {
+      std::swap(near_child, far_child);
+      std::swap(near_fraction, far_fraction);
+    }
+    if (near_fraction < (closest_hit ? closest_hit->fraction : no_hit)) {
+      raycastNode(near_child, start, end, intersect, closest_hit);
+    }
+    if (far_fraction < (closest_hit ? closest_hit->fraction : no_hit)) {
+      raycastNode(far_child, start, end, intersect, closest_hit);
+    }
+  }
+};
+} // namespace GameEngine::Geometry
+
+#endif
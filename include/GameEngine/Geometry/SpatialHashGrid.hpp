@@ -0,0 +1,79 @@
+/** @file
+ * Contains a uniform grid for finding objects close to each other.
+ */
+
+#ifndef GAME_ENGINE_INCLUDE_GAME_ENGINE_GEOMETRY_SPATIAL_HASH_GRID_HPP
+#define GAME_ENGINE_INCLUDE_GAME_ENGINE_GEOMETRY_SPATIAL_HASH_GRID_HPP
+
+#include "GameEngine/Geometry.hpp"
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace GameEngine::Geometry {
+/** Sorts bounding boxes into uniformly sized cells to find entries which may overlap without
+ * comparing them with every other entry. Entries are identified by an index chosen by the caller,
+ * e.g. their position in a container. */
+class SpatialHashGrid {
+public:
+  /** @param cell_size Side length of each cell in the game world. Should be close to the size of
+   * typical entries. Will be clamped to a small positive value. */
+  SpatialHashGrid(float cell_size);
+
+  /** @return Side length of each cell in the game world. */
+  float getCellSize() const;
+
+  /** Insert an entry or update its bounding box if it already exists. Entries which don't move to
+   * other cells are left untouched. Entries covering too many cells, e.g. huge static shapes or
+   * boxes at absurd coordinates, are kept in a separate list which gets checked by every query.
+   *
+   * @param index Identifies the entry.
+   * @param bounding_box Area covered by the entry in the game world.
+   */
+  void insert(size_t index, const BoundingBox &bounding_box);
+
+  /** Remove the entry with the given index. Does nothing if the entry does not exist. */
+  void remove(size_t index);
+
+  /** Remove all entries. */
+  void clear();
+
+  /** Find all entries which may overlap with the given area.
+   *
+   * @param bounding_box Area to search in.
+   * @param result Will be cleared and filled with the indices of all entries sharing at least one
+   * cell with the given area. Sorted in ascending order and free of duplicates. Passed by reference
+   * to allow reusing its memory.
+   */
+  void query(const BoundingBox &bounding_box, std::vector<size_t> &result) const;
+
+private:
+  /** Inclusive range of cells covered by a bounding box. */
+  struct CellRange {
+    int32_t min_x;
+    int32_t min_y;
+    int32_t max_x;
+    int32_t max_y;
+  };
+
+  float cell_size;
+
+  /** Maps cell coordinates to the indices of all entries covering it. Cells which become empty are
+   * kept to allow reusing their memory. */
+  std::unordered_map<uint64_t, std::vector<size_t>> cells;
+
+  /** Cells covered by each entry. Indexed by the entries index. */
+  std::vector<std::optional<CellRange>> entries;
+
+  /** Indices of all entries which cover too many cells to be stored in each of them. */
+  std::vector<size_t> oversized_entries;
+
+  CellRange computeCellRange(const BoundingBox &bounding_box) const;
+
+  /** @return True if the given range covers too many cells to store an entry in each of them. */
+  static bool isOversized(const CellRange &range);
+};
+} // namespace GameEngine::Geometry
+
+#endif
@@ -0,0 +1,115 @@
+/** @file
+ * Contains a sequence container which stores small amounts of elements without heap allocations.
+ */
+
+#ifndef GAME_ENGINE_INCLUDE_GAME_ENGINE_INLINE_VECTOR_HPP
+#define GAME_ENGINE_INCLUDE_GAME_ENGINE_INLINE_VECTOR_HPP
+
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <vector>
+
+namespace GameEngine {
+/** Sequence container which stores up to inline_capacity elements inside itself. Falls back to heap
+ * allocated storage if more elements are added. Intended for small, cheaply copyable types like
+ * vertices. */
+template <typename T, size_t inline_capacity> class InlineVector {
+public:
+  using value_type = T;
+  using size_type = size_t;
+  using iterator = T *;
+  using const_iterator = const T *;
+
+  InlineVector() = default;
+
+  InlineVector(std::initializer_list<T> elements)
+      : InlineVector{elements.begin(), elements.end()} {}
+
+  template <typename Iterator> InlineVector(Iterator begin, Iterator end) {
+    for (; begin != end; ++begin) {
+      push_back(*begin);
+    }
+  }
+
+  /** @return True if the elements are stored in heap allocated memory. */
+  bool isOnHeap() const { return !heap_elements.empty(); }
+
+  size_t size() const { return isOnHeap() ? heap_elements.size() : inline_element_count; }
+  bool empty() const { return size() == 0; }
+
+  T *data() { return isOnHeap() ? heap_elements.data() : inline_elements.data(); }
+  const T *data() const { return isOnHeap() ? heap_elements.data() : inline_elements.data(); }
+
+  T *begin() { return data(); }
+  T *end() { return data() + size(); }
+  const T *begin() const { return data(); }
+  const T *end() const { return data() + size(); }
+  const T *cbegin() const { return data(); }
+  const T *cend() const { return data() + size(); }
+
+  T &operator[](const size_t index) { return data()[index]; }
+  const T &operator[](const size_t index) const { return data()[index]; }
+
+  T &at(const size_t index) {
+    if (index >= size()) {
+      throw std::out_of_range{"InlineVector: index out of range"};
+    }
+    return data()[index];
+  }
+  const T &at(const size_t index) const {
+    if (index >= size()) {
+      throw std::out_of_range{"InlineVector: index out of range"};
+    }
+    return data()[index];
+  }
+
+  T &front() { return data()[0]; }
+  const T &front() const { return data()[0]; }
+  T &back() { return data()[size() - 1]; }
+  const T &back() const { return data()[size() - 1]; }
+
+  void push_back(const T &element) {
+    if (isOnHeap()) {
+      heap_elements.push_back(element);
+    } else if (inline_element_count < inline_capacity) {
+      inline_elements[inline_element_count] = element;
+      ++inline_element_count;
+    } else {
+      heap_elements.reserve(inline_capacity * 2);
+      heap_elements.assign(inline_elements.cbegin(), inline_elements.cend());
+      heap_elements.push_back(element);
+      inline_element_count = 0;
+    }
+  }
+
+  /** Resize this container. New elements will be value-initialized. */
+  void resize(const size_t new_size) {
+    if (isOnHeap()) {
+      heap_elements.resize(new_size);
+    } else if (new_size <= inline_element_count) {
+      inline_element_count = new_size;
+    } else {
+      while (size() < new_size) {
+        push_back(T{});
+      }
+    }
+  }
+
+  /** Remove all elements. Heap memory, if any, is kept for reuse. */
+  void clear() {
+    heap_elements.clear();
+    inline_element_count = 0;
+  }
+
+private:
+  std::array<T, inline_capacity> inline_elements{};
+  size_t inline_element_count = 0;
+
+  /** Contains all elements if the inline capacity got exceeded, empty otherwise. */
+  std::vector<T> heap_elements;
+};
+} // namespace GameEngine
+
+#endif
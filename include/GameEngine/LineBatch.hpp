@@ -0,0 +1,51 @@
+/** @file
+ * Contains a class for drawing many lines with a single draw call.
+ */
+
+#ifndef GAME_ENGINE_INCLUDE_GAME_ENGINE_LINE_BATCH_HPP
+#define GAME_ENGINE_INCLUDE_GAME_ENGINE_LINE_BATCH_HPP
+
+#include "GameEngine/Geometry.hpp"
+#include <SDL_pixels.h>
+#include <SDL_render.h>
+#include <glm/vec2.hpp>
+#include <vector>
+
+namespace GameEngine {
+/** Collects colored lines in screen coordinates and submits them to the renderer at once. Each
+ * line is stored as a quad with a width of one pixel, which allows drawing lines of different
+ * colors with a single call to SDL_RenderGeometry(). */
+class LineBatch {
+public:
+  /** @param color Color of all lines added after this call. Defaults to white. */
+  void setColor(SDL_Color color);
+
+  /** Add a line in screen coordinates. Lines of zero length will be drawn as a single pixel. */
+  void addLine(glm::vec2 start, glm::vec2 end);
+
+  /** Add the edges of the given polygon.
+   *
+   * @param polygon Zero or more points in screen coordinates.
+   */
+  void addPolygon(const Geometry::VertexList &polygon);
+
+  /** Remove all lines, keeping the allocated memory for reuse. */
+  void clear();
+
+  /** Draw all collected lines and clear this batch. */
+  void render(SDL_Renderer *renderer);
+
+  /** @return Four vertices for each line. */
+  const std::vector<SDL_Vertex> &getVertices() const;
+
+  /** @return Indices of two triangles for each line. */
+  const std::vector<int> &getIndices() const;
+
+private:
+  SDL_Color color{255, 255, 255, 255};
+  std::vector<SDL_Vertex> vertices;
+  std::vector<int> indices;
+};
+} // namespace GameEngine
+
+#endif
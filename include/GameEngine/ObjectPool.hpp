@@ -0,0 +1,173 @@
+/** @file
+ * Contains a container which stores objects of the same type in reusable blocks of memory.
+ */
+
+#ifndef GAME_ENGINE_INCLUDE_GAME_ENGINE_OBJECT_POOL_HPP
+#define GAME_ENGINE_INCLUDE_GAME_ENGINE_OBJECT_POOL_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace GameEngine {
+/** Stores objects of the given type in blocks of block_size slots. Objects never move in memory,
+ * so pointers to them stay valid until they get destroyed. Destroyed slots are reused by the next
+ * create() call and blocks are only released when the pool gets destroyed. This allows spawning and
+ * removing many objects, or rebuilding whole levels, without allocating memory for each object.
+ *
+ * @code
+ * ObjectPool<Physics::DynamicObject> boxes;
+ * const auto handle = boxes.create(std::initializer_list<glm::vec2>{{0, 0}, {1, 0}, {1, 1}});
+ * boxes.get(handle)->setVelocity({0, 1});
+ * boxes.destroy(handle);
+ * @endcode
+ */
+template <typename T, size_t block_size = 64> class ObjectPool {
+public:
+  /** Identifies an object in the pool. Handles of destroyed objects stay invalid, even if their
+   * slot gets reused. */
+  struct Handle {
+    uint32_t index = std::numeric_limits<uint32_t>::max();
+    uint32_t generation = 0;
+
+    bool operator==(const Handle &other) const {
+      return index == other.index && generation == other.generation;
+    }
+    bool operator!=(const Handle &other) const { return !(*this == other); }
+  };
+
+  ObjectPool() = default;
+  ~ObjectPool() { clear(); }
+  ObjectPool(const ObjectPool &) = delete;
+  ObjectPool &operator=(const ObjectPool &) = delete;
+
+  /** Moves all objects without changing their address. Pointers and handles stay valid. */
+  ObjectPool(ObjectPool &&other) noexcept
+      : blocks{std::move(other.blocks)}, slot_count{std::exchange(other.slot_count, 0)},
+        first_free_slot{std::exchange(other.first_free_slot, no_slot)},
+        object_count{std::exchange(other.object_count, 0)} {}
+
+  ObjectPool &operator=(ObjectPool &&other) noexcept {
+    clear();
+    blocks = std::move(other.blocks);
+    slot_count = std::exchange(other.slot_count, 0);
+    first_free_slot = std::exchange(other.first_free_slot, no_slot);
+    object_count = std::exchange(other.object_count, 0);
+    return *this;
+  }
+
+  /** Construct a new object in a free slot. Only allocates if all blocks are full.
+   *
+   * @param arguments Will be passed to the constructor of the object.
+   *
+   * @return Handle of the new object.
+   */
+  template <typename... Arguments> Handle create(Arguments &&...arguments) {
+    const auto reuses_slot = first_free_slot != no_slot;
+    const auto index = reuses_slot ? first_free_slot : slot_count;
+    if (index / block_size == blocks.size()) {
+      blocks.push_back(std::make_unique<Slot[]>(block_size));
+    }
+
+    /* Only update the free list once the constructor succeeded. */
+    auto &slot = getSlot(index);
+    new (slot.storage) T(std::forward<Arguments>(arguments)...);
+    slot.is_alive = true;
+    if (reuses_slot) {
+      first_free_slot = slot.next_free_slot;
+    } else {
+      ++slot_count;
+    }
+    ++object_count;
+    return {index, slot.generation};
+  }
+
+  /** Destroy the object with the given handle and release its slot for reuse. Does nothing if the
+   * handle is invalid. */
+  void destroy(const Handle handle) {
+    if (get(handle) == nullptr) {
+      return;
+    }
+    destroySlot(handle.index);
+  }
+
+  /** @return Object with the given handle. Null if the handle is invalid. */
+  T *get(const Handle handle) {
+    if (handle.index >= slot_count) {
+      return nullptr;
+    }
+    auto &slot = getSlot(handle.index);
+    return slot.is_alive && slot.generation == handle.generation ? slot.get() : nullptr;
+  }
+
+  /** @return Object with the given handle. Null if the handle is invalid. */
+  const T *get(const Handle handle) const { return const_cast<ObjectPool *>(this)->get(handle); }
+
+  /** @return Amount of objects in this pool. */
+  size_t size() const { return object_count; }
+
+  /** @return Amount of objects which can be stored without allocating another block. */
+  size_t capacity() const { return blocks.size() * block_size; }
+
+  /** Destroy all objects. Keeps all blocks for reuse, which get filled from the start again.
+   * Invalidates all handles. */
+  void clear() {
+    for (uint32_t index = 0; index < slot_count; ++index) {
+      auto &slot = getSlot(index);
+      if (slot.is_alive) {
+        slot.get()->~T();
+        slot.is_alive = false;
+        ++slot.generation;
+      }
+    }
+    slot_count = 0;
+    first_free_slot = no_slot;
+    object_count = 0;
+  }
+
+private:
+  static constexpr uint32_t no_slot = std::numeric_limits<uint32_t>::max();
+
+  struct Slot {
+    alignas(T) std::byte storage[sizeof(T)];
+
+    /** Gets incremented each time the object in this slot gets destroyed. */
+    uint32_t generation = 0;
+
+    /** Only valid for slots in the free list. */
+    uint32_t next_free_slot = no_slot;
+
+    bool is_alive = false;
+
+    T *get() { return std::launder(reinterpret_cast<T *>(storage)); }
+  };
+
+  std::vector<std::unique_ptr<Slot[]>> blocks;
+
+  /** Amount of slots in use or in the free list. Slots behind it are unused. */
+  uint32_t slot_count = 0;
+
+  /** Slot of the most recently destroyed object, which links to the next free slot. */
+  uint32_t first_free_slot = no_slot;
+
+  size_t object_count = 0;
+
+  Slot &getSlot(const uint32_t index) { return blocks[index / block_size][index % block_size]; }
+
+  void destroySlot(const uint32_t index) {
+    auto &slot = getSlot(index);
+    slot.get()->~T();
+    slot.is_alive = false;
+    ++slot.generation;
+    slot.next_free_slot = first_free_slot;
+    first_free_slot = index;
+    --object_count;
+  }
+};
+} // namespace GameEngine
+
+#endif
@@ -36,10 +36,14 @@ public:
   virtual void addVelocityOffset(glm::vec2 offset) override;
   const ConvexBoundingPolygon &getBoundingPolygon() const override;
   void handleCollisionWith(Physics::Object &other, glm::vec2 displacement_vector) override;
-  void render(SDL_Renderer *renderer, const Camera &camera,
+  bool isSleeping() const override;
+  void wakeUp() override;
+  void render(LineBatch &line_batch, const Camera &camera,
               float integrator_tick_blend_value) const override;
 
   glm::vec2 getVelocity() const override;
+
+  /** @param velocity New velocity of this object. Wakes the object up if it is sleeping. */
   void setVelocity(glm::vec2 velocity);
 
   /** @return Positive value, continuously applied to the object orthogonal to the current slope. */
@@ -70,6 +74,16 @@ public:
    * to the expected range. */
   void setAirFriction(float air_friction);
 
+  uint32_t getCollisionLayers() const override;
+
+  /** @param collision_layers Bit set of the collision layers this object belongs to. */
+  void setCollisionLayers(uint32_t collision_layers);
+
+  uint32_t getCollisionMask() const override;
+
+  /** @param collision_mask Bit set of the collision layers this object collides with. */
+  void setCollisionMask(uint32_t collision_mask);
+
 private:
   ConvexBoundingPolygon bounding_polygon;
 
@@ -97,6 +111,14 @@ private:
   /** True if the object is hitting another object from below. */
   bool is_touching_ceiling = false;
 
+  /** Amount of consecutive ticks during which this object was resting on the ground. */
+  uint16_t ticks_at_rest = 0;
+
+  bool is_sleeping = false;
+
+  uint32_t collision_layers = 1;
+  uint32_t collision_mask = all_collision_layers;
+
   /** Used for tick-independent rendering by interpolating with the current state. */
   struct {
     bool touching_ground;
@@ -5,8 +5,10 @@
 #ifndef GAME_ENGINE_INCLUDE_GAME_ENGINE_PHYSICS_INTEGRATOR_HPP
 #define GAME_ENGINE_INCLUDE_GAME_ENGINE_PHYSICS_INTEGRATOR_HPP
 
+#include "GameEngine/Geometry.hpp"
 #include "GameEngine/Physics/Object.hpp"
 #include <chrono>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -15,8 +17,54 @@ namespace GameEngine::Physics {
  * previous tick to be independent of the rendering framerate. */
 class Integrator {
 public:
+  /** Work done by the last integrate() call, summed up over all ticks it processed. Only collected
+   * if the engine was built with GAME_ENGINE_ENABLE_STATISTICS, otherwise all values stay zero.
+   * See isStatisticsEnabled(). */
+  struct Statistics {
+    /** Amount of ticks processed. */
+    size_t ticks = 0;
+
+    /** Amount of velocity/collision substeps applied to moving objects. */
+    size_t substeps = 0;
+
+    /** Amount of polygon pairs whose bounding boxes overlapped and which were checked for an
+     * actual collision. */
+    size_t narrowphase_tests = 0;
+
+    /** Amount of collisions which were reported to the colliding objects. */
+    size_t collisions = 0;
+
+    /** Sum of the objects left in the list of objects with remaining velocity, counted for each
+     * pass over that list. */
+    size_t unprocessed_object_iterations = 0;
+
+    /** Amount of times an object reached the step limit of a tick with motion remaining. Its last
+     * step swept it towards its first contact and the motion behind it was dropped. */
+    size_t dropped_motions = 0;
+
+    /** Time spent calling update() on all objects. */
+    std::chrono::nanoseconds update_time{};
+
+    /** Time spent moving objects and resolving collisions. */
+    std::chrono::nanoseconds collision_time{};
+  };
+
+  Integrator();
+  ~Integrator();
+
+  /** Leaves the other integrator in the state of a newly constructed one. */
+  Integrator(Integrator &&other);
+  Integrator &operator=(Integrator &&other);
+
   /** Advance the state of the given objects, compensating for inconstant framerates. To be called
-   * every frame.
+   * every frame. Once the internal buffers have grown to fit the scene, this doesn't allocate
+   * memory, as long as no polygon has more than 8 separating axes. Polygons with more axes don't
+   * fit into the inline storage of Geometry::VertexList.
+   *
+   * Objects are recognized by their address and their position in the list. The body type of each
+   * object, and the shape and collision layers of static objects, only get read when an object
+   * appears at a new position or after passing its position to invalidate(). Static objects are
+   * neither updated nor read by ticks, so their cost doesn't grow with the amount of ticks.
    *
    * @param duration_of_last_frame Total time elapsed during the last frame. This includes the
    * previous call of this function.
@@ -25,11 +73,38 @@ public:
   void integrate(std::chrono::microseconds duration_of_last_frame,
                  const std::vector<std::unique_ptr<Object>> &objects);
 
+  /** Same as the overload taking owning pointers, but for objects owned by someone else, e.g. by an
+   * ObjectPool. The indices used by queryArea() refer to positions in the given list. */
+  void integrate(std::chrono::microseconds duration_of_last_frame,
+                 const std::vector<Object *> &objects);
+
+  /** Read the object at the given position of the object list again during the next integrate()
+   * call, as if it was new. Required after changing the body type of an object or the shape or
+   * collision layers of a static object. Also required for objects created at the address of a
+   * destroyed object which was at the same position, e.g. by reusing a slot of an ObjectPool.
+   * Does nothing if the position is not part of the last object list. */
+  void invalidate(size_t index);
+
   /** @return Value between 0 and 1 representing the amount of unprocessed time remaining for the
    * current frame. Used for rendering intermediate states, where 0.0f refers to the objects state
    * at the previous tick and 1.0f refers to the current state. */
   float getRendererInterpolationValue() const;
 
+  /** @return Work done by the last integrate() call. */
+  const Statistics &getStatistics() const;
+
+  /** @return True if the engine was built with GAME_ENGINE_ENABLE_STATISTICS. */
+  static bool isStatisticsEnabled();
+
+  /** @return Amount of ticks processed since construction. Identifies the current point in
+   * simulation time independently of the wall clock, e.g. for replays or simulations running
+   * faster than real time. */
+  uint64_t getTickCount() const;
+
+  /** @return Amount of time simulated by a single tick. Passing this to integrate() advances the
+   * simulation by exactly one tick. */
+  static std::chrono::microseconds getTickDuration();
+
   /** @return Positive value determining the speed of the game logic. E.g. 0.5f for half the speed
    * or 2.0f to run twice as fast. */
   float getSpeedFactor() const;
@@ -38,10 +113,83 @@ public:
    * speed or 2.0f to run twice as fast. If negative will be set to zero. */
   void setSpeedFactor(float speed_factor);
 
+  /** @return Fraction of the smallest extent of each object which it may move in a single step.
+   * See setSubstepSafetyFactor(). */
+  float getSubstepSafetyFactor() const;
+
+  /** Objects moving further than their substep length during a tick get swept towards their first
+   * contact, slower objects get moved in a single step and pushed out of everything they overlap
+   * afterwards. Fast kinematic objects get moved in steps no longer than their own substep length
+   * and that of the dynamic objects in their way, which get pushed out of them after each step. The
+   * substep length of each object is its smallest extent multiplied by the given factor, so large
+   * objects need less collision work than small ones. Values above 0.5 allow slow objects to end up
+   * with their center behind thin walls and get pushed out on the wrong side.
+   *
+   * @param safety_factor Fraction of the smallest extent of each object. Defaults to 0.5. Will be
+   * clamped between a small positive value and 1.
+   */
+  void setSubstepSafetyFactor(float safety_factor);
+
+  /** @return Side length of the cells used for finding objects which may collide. */
+  float getBroadphaseCellSize() const;
+
+  /** @param cell_size Side length of the cells used for finding objects which may collide. Should
+   * be close to the size of typical objects. Will be clamped to a small positive value. */
+  void setBroadphaseCellSize(float cell_size);
+
+  /** Find all objects in the given area. Uses the bounding boxes of the objects at the end of the
+   * last tick.
+   *
+   * @param area Region in the game world to search in.
+   * @param result Will be cleared and filled with the indices of all objects passed to the last
+   * integrate() call whose bounding boxes overlap the given area. Sorted in ascending order.
+   * Static geometry is included if the bounding box around all of its shapes overlaps the area.
+   */
+  void queryArea(const Geometry::BoundingBox &area, std::vector<size_t> &result) const;
+
+  /** @return Largest distance moved by an object during the last tick. Objects rendered between
+   * their previous and current position may be this far outside of their bounding boxes known to
+   * queryArea(). */
+  float getLargestMotion() const;
+
+  /** @return Amount of threads processing ticks in addition to the calling thread. Zero if ticks
+   * are processed serially. */
+  size_t getWorkerCount() const;
+
+  /** Enable or disable parallel tick processing. In parallel mode update() gets called
+   * concurrently for different objects and moving objects are grouped into islands of objects
+   * which may touch during the current tick. Islands get processed independently of each other,
+   * with static objects being shared between them. Results are bit-identical for any amount of
+   * workers, but not identical to serial processing: objects with remaining motion take their
+   * substeps in an order which depends on all other objects in the same list, and objects pushed
+   * out of the region expected for them only collide with other islands in the next tick. Serial
+   * and parallel simulations of the same scene therefore diverge slightly over time. Since static
+   * objects are shared, their collisions get collected and reported to them by the calling thread
+   * after all islands were processed, in the order of the islands. This keeps the calls of
+   * Object::handleCollisionWith() on static objects independent of the amount of workers.
+   *
+   * @param worker_count Amount of threads to spawn in addition to the calling thread. Zero
+   * disables parallel processing, which is the default.
+   */
+  void setWorkerCount(size_t worker_count);
+
 private:
   std::chrono::microseconds leftover_time_from_last_tick{};
 
+  uint64_t tick_count = 0;
+
+  Statistics statistics;
+
   float speed_factor = 1;
+
+  float substep_safety_factor = 0.5;
+
+  /** State reused between ticks, defined in the source file. */
+  struct TickState;
+  std::unique_ptr<TickState> tick_state;
+
+  /** Exchange all state with the given integrator. */
+  void swap(Integrator &other) noexcept;
 };
 } // namespace GameEngine::Physics
 
@@ -7,7 +7,6 @@
 
 #include "GameEngine/HorizontalDirection.hpp"
 #include "GameEngine/Physics/DynamicObject.hpp"
-#include <chrono>
 
 namespace GameEngine::Physics {
 /** Physical object which can accelerate and run up slopes, move in the air and do wall jumps.
@@ -24,7 +23,7 @@ public:
   void update() override;
 
   /** Try to do a jump, walljump or airjump depending on the situation. Calls to this function will
-   * be buffered for a very short time to remove the need for pixel-perfect user input. */
+   * be buffered for a few ticks to remove the need for pixel-perfect user input. */
   void jump();
 
   /** @param direction Optional horizontal acceleration to be applied to the object. If no direction
@@ -113,9 +112,10 @@ private:
   /** Friction of the floor applied when the object stops running. */
   float ground_grip = 0.05;
 
-  /** Timepoint at which jump() was called. Allows pressing the jump button slightly before the
-   * ground or wall is touched. */
-  std::chrono::steady_clock::time_point time_of_jump_request{};
+  /** Amount of ticks during which a call to jump() will still be considered. Allows pressing the
+   * jump button slightly before the ground or wall is touched. Counted in ticks instead of wall
+   * clock time to keep the simulation independent of the speed at which it runs. */
+  uint16_t jump_request_ticks_remaining = 0;
 
   std::optional<HorizontalDirection> acceleration_direction = std::nullopt;
 };
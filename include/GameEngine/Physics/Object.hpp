@@ -7,17 +7,44 @@
 
 #include "GameEngine/ConvexBoundingPolygon.hpp"
 #include "GameEngine/Renderable.hpp"
+#include <cstdint>
 #include <glm/vec2.hpp>
+#include <limits>
 
 namespace GameEngine::Physics {
+class StaticGeometry;
+
+/** Determines how the physics engine moves an object and which objects it gets checked against. */
+enum class BodyType : uint8_t {
+  /** Never moves, never gets updated and ignores collisions. Only checked against dynamic objects.
+   * Allows the physics engine to share it between objects processed in parallel. Changes require
+   * Integrator::invalidate(). */
+  Static,
+
+  /** Moves by its velocity without being stopped or pushed by other objects. Only checked against
+   * dynamic objects, which get pushed out of it. Fast kinematic objects get moved in steps no
+   * longer than the substep length of the dynamic objects in their way, see
+   * Integrator::setSubstepSafetyFactor(). Beyond the step limit of each tick, they may still pass
+   * through small dynamic objects. */
+  Kinematic,
+
+  /** Moves by its velocity and collides with all other objects. */
+  Dynamic,
+};
+
+/** Bit set containing all collision layers. */
+constexpr uint32_t all_collision_layers = std::numeric_limits<uint32_t>::max();
+
 /** Represents an object which can move and collide with other objects. */
 class Object : public Renderable {
 public:
   virtual ~Object() = default;
 
   /** Update the state of the object including its velocity vector. This function should not apply
-   * the velocity. Will be called once at the beginning of each tick. Will be called before
-   * addVelocityStep() and handleCollisionWith().  */
+   * the velocity. Will be called once at the beginning of each tick, except for static objects,
+   * which are expected to never change. Will be called before
+   * addVelocityStep() and handleCollisionWith(). May be called concurrently for different objects,
+   * so implementations must only modify the state of their own object. */
   virtual void update() = 0;
 
   /** @return Current velocity of this object. Will be applied by the physics engine. */
@@ -34,12 +61,39 @@ public:
   virtual const ConvexBoundingPolygon &getBoundingPolygon() const = 0;
 
   /** Will be called if a collision occurred. Two objects may collide multiple times during the same
-   * tick.
+   * tick. In parallel mode, see Integrator::setWorkerCount(), this gets called concurrently for
+   * different moving objects, so implementations must only modify the state of their own object.
+   * Static objects are shared between threads and get all their collisions reported by the calling
+   * thread after the moving objects were processed, with the other object in its final state of
+   * the tick.
    *
    * @param other Object which this object collided with.
    * @param displacement_vector Offset for moving this object out of the other object.
    */
   virtual void handleCollisionWith(Object &other, glm::vec2 displacement_vector) = 0;
+
+  /** @return Role of this object in the physics engine. Defaults to dynamic. Kinematic objects
+   * must not move themselves in handleCollisionWith(). */
+  virtual BodyType getBodyType() const { return BodyType::Dynamic; }
+
+  /** @return Bit set of the collision layers this object belongs to. Two objects only collide if
+   * each of them is part of a layer contained in the collision mask of the other. */
+  virtual uint32_t getCollisionLayers() const { return 1; }
+
+  /** @return Bit set of the collision layers this object collides with. */
+  virtual uint32_t getCollisionMask() const { return all_collision_layers; }
+
+  /** @return True if this object is resting and should be skipped by the physics engine until it
+   * gets woken up. Sleeping objects still collide with other objects. */
+  virtual bool isSleeping() const { return false; }
+
+  /** Resume processing of this object if it is sleeping. Will be called by the physics engine if
+   * other objects move close to it. */
+  virtual void wakeUp() {}
+
+  /** @return Shapes which the physics engine should collide against individually, instead of using
+   * getBoundingPolygon(). Null for regular objects. */
+  virtual const StaticGeometry *getStaticGeometry() const { return nullptr; }
 };
 } // namespace GameEngine::Physics
 
@@ -0,0 +1,82 @@
+/** @file
+ * Contains a class representing baked, immutable world geometry.
+ */
+
+#ifndef GAME_ENGINE_INCLUDE_GAME_ENGINE_PHYSICS_STATIC_GEOMETRY_HPP
+#define GAME_ENGINE_INCLUDE_GAME_ENGINE_PHYSICS_STATIC_GEOMETRY_HPP
+
+#include "GameEngine/ConvexBoundingPolygon.hpp"
+#include "GameEngine/Geometry.hpp"
+#include "GameEngine/Geometry/BVH.hpp"
+#include "GameEngine/Physics/Object.hpp"
+#include <optional>
+#include <vector>
+
+namespace GameEngine::Physics {
+/** Solid, non-interactive shapes making up a level, e.g. walls and platforms. Behaves like one
+ * StaticObject per shape, but stores all shapes in a single list with a bounding volume hierarchy.
+ * The physics engine handles it as a single object and collides moving objects against the
+ * individual shapes. Can't be modified after construction. */
+class StaticGeometry : public Object {
+public:
+  /** Bake the given shapes into a collision structure. Line segments which lie on the same line and
+   * touch or overlap each other get merged into a single segment. Polygons sharing a whole edge get
+   * merged into a single polygon if the result is convex and has at most 8 vertices, e.g. a row of
+   * tiles becomes one box. Polygons sharing only parts of an edge stay separate.
+   *
+   * @param shapes Convex polygons in the game world. Shapes without vertices will be ignored.
+   */
+  explicit StaticGeometry(const std::vector<Geometry::VertexList> &shapes);
+
+  /** @return All shapes after merging. */
+  const std::vector<ConvexBoundingPolygon> &getShapes() const;
+
+  /** @return Smallest axis-aligned box containing all shapes. Contains only the point {0, 0} if
+   * there are no shapes. */
+  const Geometry::BoundingBox &getBoundingBox() const;
+
+  /** Find all shapes which may overlap the given area.
+   *
+   * @param area Region in the game world to search in.
+   * @param result Will be cleared and filled with the indices of all shapes whose bounding boxes
+   * overlap the given area. Sorted in ascending order.
+   */
+  void queryArea(const Geometry::BoundingBox &area, std::vector<size_t> &result) const;
+
+  /** Find the first shape hit by the given line segment, e.g. for checking the line of sight.
+   *
+   * @param start Start of the segment in the game world.
+   * @param end End of the segment in the game world.
+   *
+   * @return Index of the shape and the position along the segment at which it got hit. Nothing if
+   * the segment doesn't touch any shape.
+   */
+  std::optional<Geometry::BVH::RaycastHit> raycast(glm::vec2 start, glm::vec2 end) const;
+
+  void update() override;
+  glm::vec2 getVelocity() const override;
+  void addVelocityOffset(glm::vec2) override;
+
+  /** @return Polygon without vertices. Use getShapes() instead. */
+  const ConvexBoundingPolygon &getBoundingPolygon() const override;
+
+  void handleCollisionWith(Object &, glm::vec2) override;
+  BodyType getBodyType() const override;
+  const StaticGeometry *getStaticGeometry() const override;
+
+  /** Render all shapes visible through the given camera. */
+  void render(LineBatch &line_batch, const Camera &camera,
+              float integrator_tick_blend_factor) const override;
+
+private:
+  std::vector<ConvexBoundingPolygon> shapes;
+  Geometry::BoundingBox bounding_box{};
+  Geometry::BVH shape_index;
+  ConvexBoundingPolygon empty_polygon{};
+
+  /** Reused for each frame to avoid allocations. */
+  mutable std::vector<size_t> visible_shapes;
+};
+} // namespace GameEngine::Physics
+
+#endif
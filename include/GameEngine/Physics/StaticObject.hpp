@@ -25,12 +25,33 @@ public:
   virtual void addVelocityOffset(glm::vec2) override;
   const ConvexBoundingPolygon &getBoundingPolygon() const override;
   void handleCollisionWith(Physics::Object &, glm::vec2) override;
-  void render(SDL_Renderer *renderer, const Camera &camera,
+  BodyType getBodyType() const override;
+  void render(LineBatch &line_batch, const Camera &camera,
               float integrator_tick_blend_factor) const override;
 
+  uint32_t getCollisionLayers() const override;
+
+  /** Once this object was passed to Physics::Integrator::integrate(), the integrator only picks
+   * up the change after passing the position of this object to Physics::Integrator::invalidate().
+   *
+   * @param collision_layers Bit set of the collision layers this object belongs to.
+   */
+  void setCollisionLayers(uint32_t collision_layers);
+
+  uint32_t getCollisionMask() const override;
+
+  /** Requires invalidation like setCollisionLayers().
+   *
+   * @param collision_mask Bit set of the collision layers this object collides with.
+   */
+  void setCollisionMask(uint32_t collision_mask);
+
 private:
   glm::vec2 velocity{};
   ConvexBoundingPolygon bounding_polygon;
+
+  uint32_t collision_layers = 1;
+  uint32_t collision_mask = all_collision_layers;
 };
 } // namespace GameEngine::Physics
 
@@ -6,7 +6,7 @@
 #define GAME_ENGINE_INCLUDE_GAME_ENGINE_RENDERABLE_HPP
 
 #include "GameEngine/Camera.hpp"
-#include <SDL_render.h>
+#include "GameEngine/LineBatch.hpp"
 
 namespace GameEngine {
 /** Represents objects which can be rendered to the screen. */
@@ -16,12 +16,12 @@ public:
 
   /** Render this object to the screen.
    *
-   * @param renderer SDL renderer to use.
+   * @param line_batch Collects the lines to draw. Will be submitted to the renderer afterwards.
    * @param camera Transforms game-world coordinates to screen coordinates.
    * @param integrator_tick_blend_value Value between 0 and 1. Used for interpolating between the
    * objects state at the previous tick and its current state, where 0 means the previous state.
    */
-  virtual void render(SDL_Renderer *renderer, const Camera &camera,
+  virtual void render(LineBatch &line_batch, const Camera &camera,
                       float integrator_tick_blend_value) const = 0;
 };
 } // namespace GameEngine
@@ -0,0 +1,67 @@
+/** @file
+ * Contains a pool of worker threads for running loops in parallel.
+ */
+
+#ifndef GAME_ENGINE_INCLUDE_GAME_ENGINE_THREAD_POOL_HPP
+#define GAME_ENGINE_INCLUDE_GAME_ENGINE_THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace GameEngine {
+/** Fixed set of worker threads which wait for tasks to process in parallel. */
+class ThreadPool {
+public:
+  /** @param worker_count Amount of threads to spawn in addition to the calling thread. If zero, all
+   * tasks will be processed by the calling thread. */
+  ThreadPool(size_t worker_count);
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  /** @return Amount of threads spawned in addition to the calling thread. */
+  size_t getWorkerCount() const;
+
+  /** Call the given function for each task and block until all tasks are done. The calling thread
+   * takes part in processing. Tasks are distributed dynamically between threads, so the order in
+   * which they run is not deterministic.
+   *
+   * @param task_count Amount of tasks to process.
+   * @param function Will be called concurrently with the index of each task, starting at 0. If it
+   * throws, the first exception will be rethrown after all threads are done.
+   */
+  void forEach(size_t task_count, const std::function<void(size_t task_index)> &function);
+
+private:
+  std::vector<std::thread> workers;
+
+  std::mutex mutex;
+  std::condition_variable work_available;
+  std::condition_variable work_done;
+
+  /** Incremented each time new work gets submitted. */
+  uint64_t generation = 0;
+  bool shutting_down = false;
+
+  /** Amount of workers which did not finish the current generation yet. */
+  size_t busy_workers = 0;
+
+  const std::function<void(size_t)> *current_function = nullptr;
+  size_t task_count = 0;
+  std::atomic<size_t> next_task_index{0};
+  std::exception_ptr first_exception;
+
+  void processTasks();
+  void runWorker();
+};
+} // namespace GameEngine
+
+#endif
@@ -3,11 +3,17 @@
  */
 
 #include "GameEngine/Camera.hpp"
-#include "glm/gtx/rotate_vector.hpp"
+#include <glm/common.hpp>
+#include <glm/gtc/constants.hpp>
+#include <glm/matrix.hpp>
+#include <glm/trigonometric.hpp>
 
 namespace {
 /* Width/height of the camera in the game world on a square monitor. */
 constexpr float game_world_camera_side_length = 27;
+
+/** Keeps the transformation invertible, which fails at a zoom of zero. */
+constexpr float zoom_min = 0.01;
 } // namespace
 
 namespace GameEngine {
@@ -16,29 +22,76 @@ Camera::Camera(const size_t screen_width, const size_t screen_height)
   const float scaling_factor =
       glm::min(screen_width, screen_height) / game_world_camera_side_length;
   world_to_screen_scaling_factor = {scaling_factor, -scaling_factor};
+  updateTransform();
 }
 
 glm::vec2 Camera::toScreenCoordinate(const glm::vec2 world_coordinate) const {
-  return glm::rotate((world_coordinate - position) * world_to_screen_scaling_factor * zoom,
-                     orientation) +
-         center_on_screen;
+  return world_to_screen_matrix * world_coordinate + world_to_screen_offset;
 }
 
 glm::vec2 Camera::toWorldCoordinate(const glm::vec2 screen_coordinate) const {
-  return glm::rotate(screen_coordinate - center_on_screen, -orientation) / zoom /
-             world_to_screen_scaling_factor +
-         position;
+  return screen_to_world_matrix * screen_coordinate + screen_to_world_offset;
+}
+
+void Camera::toScreenCoordinates(const glm::vec2 *world_coordinates, const size_t count,
+                                 glm::vec2 *result) const {
+  /* Plain multiply-adds without branches, which the compiler can vectorize. */
+  const auto m = world_to_screen_matrix;
+  const auto offset = world_to_screen_offset;
+  for (size_t index = 0; index < count; ++index) {
+    const auto world_coordinate = world_coordinates[index];
+    result[index] = {m[0][0] * world_coordinate.x + m[1][0] * world_coordinate.y + offset.x,
+                     m[0][1] * world_coordinate.x + m[1][1] * world_coordinate.y + offset.y};
+  }
 }
 
-void Camera::setPosition(const glm::vec2 position) { this->position = position; }
+Geometry::VertexList
+Camera::toScreenCoordinates(const Geometry::VertexList &world_coordinates) const {
+  Geometry::VertexList result;
+  result.resize(world_coordinates.size());
+  toScreenCoordinates(world_coordinates.data(), world_coordinates.size(), result.data());
+  return result;
+}
 
-void Camera::setZoom(const float zoom) { this->zoom = glm::max(zoom, 0.0f); }
+Geometry::BoundingBox Camera::getVisibleArea() const {
+  const auto screen_size = center_on_screen * 2.0f;
+  const Geometry::VertexList corners{
+      toWorldCoordinate({0, 0}), toWorldCoordinate({screen_size.x, 0}),
+      toWorldCoordinate(screen_size), toWorldCoordinate({0, screen_size.y})};
+  return Geometry::computeBoundingBox(corners);
+}
+
+void Camera::setPosition(const glm::vec2 position) {
+  this->position = position;
+  updateTransform();
+}
+
+void Camera::setZoom(const float zoom) {
+  this->zoom = glm::max(zoom, zoom_min);
+  updateTransform();
+}
 
 void Camera::setOrientation(const float orientation) {
   this->orientation = glm::mod(orientation, glm::two_pi<float>());
+  updateTransform();
 }
 
 void Camera::stepTowardsPosition(const glm::vec2 target_position) {
   position += (target_position - position) * 0.1f;
+  updateTransform();
+}
+
+void Camera::updateTransform() {
+  const auto sine = glm::sin(orientation);
+  const auto cosine = glm::cos(orientation);
+  const glm::mat2 rotation{cosine, sine, -sine, cosine};
+  const glm::mat2 inverse_rotation = glm::transpose(rotation);
+  const auto scale = world_to_screen_scaling_factor * zoom;
+
+  world_to_screen_matrix = rotation * glm::mat2{scale.x, 0, 0, scale.y};
+  world_to_screen_offset = center_on_screen - world_to_screen_matrix * position;
+
+  screen_to_world_matrix = glm::mat2{1 / scale.x, 0, 0, 1 / scale.y} * inverse_rotation;
+  screen_to_world_offset = position - screen_to_world_matrix * center_on_screen;
 }
 } // namespace GameEngine
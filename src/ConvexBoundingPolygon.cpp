@@ -6,52 +6,51 @@
 #include "GameEngine/Geometry.hpp"
 #include <SDL_assert.h>
 #include <algorithm>
+#include <glm/geometric.hpp>
 #include <glm/gtc/constants.hpp>
 #include <glm/gtx/rotate_vector.hpp>
+#include <limits>
 #include <numeric>
 
 using namespace GameEngine;
 
 namespace {
-glm::vec2 computeCenter(const std::vector<glm::vec2> &polygon) {
+glm::vec2 computeCenter(const Geometry::VertexList &polygon) {
   return std::accumulate(polygon.cbegin(), polygon.cend(), glm::vec2{}) /
          static_cast<float>(polygon.size());
 }
 
-/** @return Normal vector orthogonal to the polygons nth edge. */
-glm::vec2 getEdgeNormal(const std::vector<glm::vec2> &polygon, const size_t edge_index) {
-  const auto [start, end] = Geometry::getEdge(polygon, edge_index);
+/** @return Normal vector orthogonal to the given edge. */
+glm::vec2 getEdgeNormal(const glm::vec2 start, const glm::vec2 end) {
   return glm::normalize(glm::vec2{start.y - end.y, end.x - start.x});
 }
 
-/** Contains the smallest and largest values found while projecting vertices onto an axis. */
-struct ProjectedVertices {
-  glm::vec2 axis; /**< Normalized axis onto which vertices got projected. */
-  float min;      /**< Smallest projected value. */
-  float max;      /**< Largest projected value. */
-};
-
-ProjectedVertices projectVerticesOntoAxis(const std::vector<glm::vec2> &polygon,
-                                          const glm::vec2 axis) {
-  const auto first_dot_product = glm::dot(polygon.front(), axis);
-  float min = first_dot_product;
-  float max = first_dot_product;
+/** @return Normalized axes required for checking the given polygon for collisions using the
+ * separating axis theorem. Parallel edges share the same axis. */
+Geometry::VertexList computeSeparatingAxes(const Geometry::VertexList &polygon) {
+  if (polygon.size() == 1) {
+    /* Use X axis as direction for polygons with only one vertex. */
+    return {{1, 0}};
+  }
 
-  for (size_t index = 1; index < polygon.size(); ++index) {
-    const auto dot_product = glm::dot(polygon[index], axis);
-    min = glm::min(min, dot_product);
-    max = glm::max(max, dot_product);
+  Geometry::VertexList axes;
+  for (const auto [start, end] : Geometry::edges(polygon)) {
+    const auto axis = getEdgeNormal(start, end);
+    const bool has_parallel_axis =
+        std::any_of(axes.cbegin(), axes.cend(), [&](const glm::vec2 other_axis) {
+          return glm::abs(axis.x * other_axis.y - axis.y * other_axis.x) <= glm::epsilon<float>();
+        });
+    if (!has_parallel_axis) {
+      axes.push_back(axis);
+    }
   }
-  return {axis, min, max};
+  return axes;
 }
 
-/** @return Overlap found while projecting the given polygons onto the specified axis. Will be < 0
- * if no overlap exists. */
-float getProjectionOverlap(const std::vector<glm::vec2> &a, const std::vector<glm::vec2> &b,
-                           const glm::vec2 axis) {
-  const auto a_projected = projectVerticesOntoAxis(a, axis);
-  const auto b_projected = projectVerticesOntoAxis(b, axis);
-  return glm::min(b_projected.max - a_projected.min, a_projected.max - b_projected.min);
+/** @return Overlap between the given projections onto the same axis. Will be < 0 if no overlap
+ * exists. */
+float getProjectionOverlap(const Geometry::Projection &a, const Geometry::Projection &b) {
+  return glm::min(b.max - a.min, a.max - b.min);
 }
 
 /** Offset for moving one polygon out of another. */
@@ -61,40 +60,68 @@ struct DisplacementVector {
 };
 
 /** @return Smallest displacement vector (MTV) for moving polygon a out of polygon b. Will return
- * nothing if no collision occurred. */
-std::optional<DisplacementVector> findSmallestDisplacementVector(const std::vector<glm::vec2> &a,
-                                                                 const std::vector<glm::vec2> &b) {
-  /** Use X axis as direction for polygons with only one vertex. */
-  auto direction_of_smallest_overlap = a.size() == 1 ? glm::vec2{1, 0} : getEdgeNormal(a, 0);
-  auto smallest_overlap = getProjectionOverlap(a, b, direction_of_smallest_overlap);
-  if (smallest_overlap <= glm::epsilon<float>()) {
+ * nothing if no collision occurred.
+ *
+ * @param a Vertices of the first polygon.
+ * @param a_axes Separating axes of the first polygon. Must contain at least one axis.
+ * @param b Vertices of the second polygon.
+ * @param separating_axis_index Will be set to the index of the axis which separates both polygons
+ * if no collision occurred.
+ */
+std::optional<DisplacementVector>
+findSmallestDisplacementVector(const Geometry::VertexList &a, const Geometry::VertexList &a_axes,
+                               const Geometry::VertexList &b, int &separating_axis_index) {
+  SDL_assert(!a_axes.empty());
+  const auto a_projections = Geometry::projectOntoAxes(a, a_axes);
+  const auto b_projections = Geometry::projectOntoAxes(b, a_axes);
+
+  DisplacementVector smallest_displacement{
+      a_axes.front(), getProjectionOverlap(a_projections.front(), b_projections.front())};
+  if (smallest_displacement.magnitude <= glm::epsilon<float>()) {
+    separating_axis_index = 0;
     return std::nullopt;
   }
 
-  const auto a_edges = Geometry::countEdges(a);
-  for (size_t index = 1; index < a_edges; ++index) {
-    const auto axis = getEdgeNormal(a, index);
-    const auto overlap = getProjectionOverlap(a, b, axis);
+  for (size_t index = 1; index < a_axes.size(); ++index) {
+    const auto overlap = getProjectionOverlap(a_projections[index], b_projections[index]);
     if (overlap <= glm::epsilon<float>()) {
+      separating_axis_index = static_cast<int>(index);
       return std::nullopt;
     }
-    if (overlap < smallest_overlap) {
-      smallest_overlap = overlap;
-      direction_of_smallest_overlap = axis;
+    if (overlap < smallest_displacement.magnitude) {
+      smallest_displacement = {a_axes[index], overlap};
     }
   }
 
-  return DisplacementVector{direction_of_smallest_overlap, smallest_overlap};
+  return smallest_displacement;
+}
+
+/** @return True if the given axis separates both polygons. Produces the same projections as
+ * findSmallestDisplacementVector(). */
+bool isSeparatingAxis(const Geometry::VertexList &a, const Geometry::VertexList &b,
+                      const glm::vec2 axis) {
+  const Geometry::VertexList axes{axis};
+  return getProjectionOverlap(Geometry::projectOntoAxes(a, axes).front(),
+                              Geometry::projectOntoAxes(b, axes).front()) <=
+         glm::epsilon<float>();
 }
 } // namespace
 
 namespace GameEngine {
 ConvexBoundingPolygon::ConvexBoundingPolygon(std::initializer_list<glm::vec2> vertices)
+    : ConvexBoundingPolygon(Geometry::VertexList{vertices}) {}
+
+ConvexBoundingPolygon::ConvexBoundingPolygon(const Geometry::VertexList &vertices)
     : bounding_polygon{vertices} {
-  position = vertices.size() == 0 ? glm::vec2{0, 0} : computeCenter(vertices);
+  position = vertices.empty() ? glm::vec2{0, 0} : computeCenter(vertices);
   std::transform(vertices.begin(), vertices.end(),
                  std::back_inserter(bounding_polygon_relative_to_center),
                  [this](const glm::vec2 vertex) { return vertex - position; });
+  if (!bounding_polygon.empty()) {
+    bounding_box = Geometry::computeBoundingBox(bounding_polygon);
+  }
+  separating_axes_relative_to_orientation = computeSeparatingAxes(bounding_polygon);
+  separating_axes = separating_axes_relative_to_orientation;
 }
 
 glm::vec2 ConvexBoundingPolygon::getPosition() const { return position; }
@@ -108,26 +135,55 @@ float ConvexBoundingPolygon::getOrientation() const { return orientation; }
 
 void ConvexBoundingPolygon::setOrientation(const float orientation) {
   this->orientation = glm::mod(orientation, glm::two_pi<float>());
+  std::transform(separating_axes_relative_to_orientation.cbegin(),
+                 separating_axes_relative_to_orientation.cend(), separating_axes.begin(),
+                 [this](const glm::vec2 axis) { return glm::rotate(axis, this->orientation); });
   recomputeBoundingPolygon();
 }
 
 std::optional<glm::vec2>
 ConvexBoundingPolygon::collidesWith(const ConvexBoundingPolygon &other) const {
-  if (this->bounding_polygon.empty() || other.bounding_polygon.empty()) {
+  SeparatingAxisHint unused_hint{};
+  return collidesWith(other, unused_hint);
+}
+
+std::optional<glm::vec2> ConvexBoundingPolygon::collidesWith(const ConvexBoundingPolygon &other,
+                                                             SeparatingAxisHint &hint) const {
+  if (this->bounding_polygon.empty() || other.bounding_polygon.empty() ||
+      !Geometry::overlaps(this->bounding_box, other.bounding_box)) {
     return std::nullopt;
   }
 
-  const auto displacement_this_from_other =
-      findSmallestDisplacementVector(this->bounding_polygon, other.bounding_polygon);
+  /* The hinted axis is one of the axes checked below, so rejecting early can't change the
+   * result. */
+  const auto this_axis_count = static_cast<int>(this->separating_axes.size());
+  const auto other_axis_count = static_cast<int>(other.separating_axes.size());
+  if (hint.axis_index >= 0 && hint.axis_index < this_axis_count + other_axis_count) {
+    const auto axis = hint.axis_index < this_axis_count
+                          ? this->separating_axes[hint.axis_index]
+                          : other.separating_axes[hint.axis_index - this_axis_count];
+    if (isSeparatingAxis(this->bounding_polygon, other.bounding_polygon, axis)) {
+      return std::nullopt;
+    }
+  }
+
+  int separating_axis_index = -1;
+  const auto displacement_this_from_other = findSmallestDisplacementVector(
+      this->bounding_polygon, this->separating_axes, other.bounding_polygon,
+      separating_axis_index);
   if (!displacement_this_from_other) {
+    hint.axis_index = separating_axis_index;
     return std::nullopt;
   }
 
-  const auto displacement_other_from_this =
-      findSmallestDisplacementVector(other.bounding_polygon, this->bounding_polygon);
+  const auto displacement_other_from_this = findSmallestDisplacementVector(
+      other.bounding_polygon, other.separating_axes, this->bounding_polygon,
+      separating_axis_index);
   if (!displacement_other_from_this) {
+    hint.axis_index = this_axis_count + separating_axis_index;
     return std::nullopt;
   }
+  hint.axis_index = -1;
 
   const auto displacement_vector = [&] {
     if (displacement_this_from_other->magnitude < displacement_other_from_this->magnitude) {
@@ -146,14 +202,79 @@ ConvexBoundingPolygon::collidesWith(const ConvexBoundingPolygon &other) const {
   return -displacement_vector;
 }
 
+std::optional<float>
+ConvexBoundingPolygon::computeTimeOfImpact(const ConvexBoundingPolygon &other,
+                                           const glm::vec2 motion,
+                                           const float penetration_depth) const {
+  if (this->bounding_polygon.empty() || other.bounding_polygon.empty()) {
+    return std::nullopt;
+  }
+
+  /* On each axis, the overlap between both projections changes linearly with the distance moved.
+   * Collect the range of moments during which all overlaps are deeper than requested. */
+  float entry = 0;
+  float exit = 1;
+  const auto clip_against_axes = [&](const Geometry::VertexList &axes) {
+    const auto this_projections = Geometry::projectOntoAxes(this->bounding_polygon, axes);
+    const auto other_projections = Geometry::projectOntoAxes(other.bounding_polygon, axes);
+    for (size_t index = 0; index < axes.size(); ++index) {
+      const auto &a = this_projections[index];
+      const auto &b = other_projections[index];
+      const auto speed = glm::dot(motion, axes[index]);
+
+      /* Required: speed * time > lower and speed * time < upper. */
+      const auto lower = penetration_depth - (a.max - b.min);
+      const auto upper = (b.max - a.min) - penetration_depth;
+      if (speed == 0) {
+        if (lower >= 0 || upper <= 0) {
+          return false;
+        }
+        continue;
+      }
+
+      const auto lower_time = lower / speed;
+      const auto upper_time = upper / speed;
+      entry = glm::max(entry, glm::min(lower_time, upper_time));
+      exit = glm::min(exit, glm::max(lower_time, upper_time));
+      if (entry >= exit) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  /* Both axis lists are checked separately to avoid copying them into a combined list. */
+  if (!clip_against_axes(this->separating_axes) || !clip_against_axes(other.separating_axes)) {
+    return std::nullopt;
+  }
+  return entry;
+}
+
+float ConvexBoundingPolygon::computeSmallestExtent() const {
+  if (bounding_polygon.size() < 3) {
+    return 0;
+  }
+  const auto projections = Geometry::projectOntoAxes(bounding_polygon, separating_axes);
+  return std::accumulate(projections.begin(), projections.end(),
+                         std::numeric_limits<float>::infinity(),
+                         [](const float smallest_extent, const Geometry::Projection &projection) {
+                           return glm::min(smallest_extent, projection.max - projection.min);
+                         });
+}
+
 void ConvexBoundingPolygon::recomputeBoundingPolygon() {
   std::transform(
       bounding_polygon_relative_to_center.cbegin(), bounding_polygon_relative_to_center.cend(),
       bounding_polygon.begin(),
       [this](const glm::vec2 vertex) { return glm::rotate(vertex, orientation) + position; });
+  if (!bounding_polygon.empty()) {
+    bounding_box = Geometry::computeBoundingBox(bounding_polygon);
+  }
 }
 
-const std::vector<glm::vec2> &ConvexBoundingPolygon::getVertices() const {
+const Geometry::VertexList &ConvexBoundingPolygon::getVertices() const {
   return bounding_polygon;
 }
+
+const Geometry::BoundingBox &ConvexBoundingPolygon::getBoundingBox() const { return bounding_box; }
 } // namespace GameEngine
@@ -4,9 +4,200 @@
 
 #include "GameEngine/Geometry.hpp"
 #include <SDL_assert.h>
+#include <glm/common.hpp>
+#include <glm/geometric.hpp>
+#include <utility>
+
+#if !defined(GAME_ENGINE_DISABLE_SIMD) && (defined(__SSE__) || defined(_M_X64))
+#define GAME_ENGINE_USE_SSE
+#include <xmmintrin.h>
+#endif
+
+namespace {
+float cross(const glm::vec2 a, const glm::vec2 b) { return a.x * b.y - a.y * b.x; }
+
+/** @return Position along the given segment at which it first touches the given line segment. */
+std::optional<float> intersectSegmentWithLine(const glm::vec2 start, const glm::vec2 end,
+                                              const glm::vec2 line_start,
+                                              const glm::vec2 line_end) {
+  const auto direction = end - start;
+  const auto line_direction = line_end - line_start;
+  const auto offset = line_start - start;
+  const auto denominator = cross(direction, line_direction);
+  if (denominator != 0) {
+    const auto fraction = cross(offset, line_direction) / denominator;
+    const auto line_fraction = cross(offset, direction) / denominator;
+    if (fraction < 0 || fraction > 1 || line_fraction < 0 || line_fraction > 1) {
+      return std::nullopt;
+    }
+    return fraction;
+  }
+
+  /* Both are parallel. They can only touch if they lie on the same line. */
+  const auto length_squared = glm::dot(direction, direction);
+  if (length_squared == 0 || cross(offset, direction) != 0) {
+    return std::nullopt;
+  }
+  const auto line_start_fraction = glm::dot(offset, direction) / length_squared;
+  const auto line_end_fraction = glm::dot(line_end - start, direction) / length_squared;
+  if (glm::max(line_start_fraction, line_end_fraction) < 0 ||
+      glm::min(line_start_fraction, line_end_fraction) > 1) {
+    return std::nullopt;
+  }
+  return glm::max(0.0f, glm::min(line_start_fraction, line_end_fraction));
+}
+} // namespace
 
 namespace GameEngine::Geometry {
-size_t countEdges(const std::vector<glm::vec2> &polygon) {
+BoundingBox computeBoundingBox(const VertexList &polygon) {
+  SDL_assert(!polygon.empty());
+  BoundingBox bounding_box{polygon.front(), polygon.front()};
+  for (size_t index = 1; index < polygon.size(); ++index) {
+    bounding_box.min = glm::min(bounding_box.min, polygon[index]);
+    bounding_box.max = glm::max(bounding_box.max, polygon[index]);
+  }
+  return bounding_box;
+}
+
+bool overlaps(const BoundingBox &a, const BoundingBox &b) {
+  return a.min.x < b.max.x && b.min.x < a.max.x && a.min.y < b.max.y && b.min.y < a.max.y;
+}
+
+std::optional<float> intersectSegment(const glm::vec2 start, const glm::vec2 end,
+                                      const BoundingBox &bounding_box) {
+  const auto direction = end - start;
+  float entry = 0;
+  float exit = 1;
+  for (int axis = 0; axis < 2; ++axis) {
+    if (direction[axis] == 0) {
+      if (start[axis] < bounding_box.min[axis] || start[axis] > bounding_box.max[axis]) {
+        return std::nullopt;
+      }
+      continue;
+    }
+    auto near = (bounding_box.min[axis] - start[axis]) / direction[axis];
+    auto far = (bounding_box.max[axis] - start[axis]) / direction[axis];
+    if (near > far) {
+      std::swap(near, far);
+    }
+    entry = glm::max(entry, near);
+    exit = glm::min(exit, far);
+    if (entry > exit) {
+      return std::nullopt;
+    }
+  }
+  return entry;
+}
+
+std::optional<float> intersectSegment(const glm::vec2 start, const glm::vec2 end,
+                                      const VertexList &polygon) {
+  if (polygon.size() < 2) {
+    return std::nullopt;
+  }
+  if (polygon.size() == 2) {
+    return intersectSegmentWithLine(start, end, polygon.front(), polygon.back());
+  }
+
+  /* Clip the segment against the inner half-plane of each edge. The center is used for orienting
+   * the edge normals outwards, which makes this independent of the winding order. */
+  glm::vec2 center{0, 0};
+  for (const auto vertex : polygon) {
+    center += vertex;
+  }
+  center /= static_cast<float>(polygon.size());
+
+  const auto direction = end - start;
+  float entry = 0;
+  float exit = 1;
+  for (const auto [edge_start, edge_end] : edges(polygon)) {
+    auto normal = glm::vec2{edge_end.y - edge_start.y, edge_start.x - edge_end.x};
+    if (glm::dot(normal, center - edge_start) > 0) {
+      normal = -normal;
+    }
+    const auto distance = glm::dot(normal, start - edge_start);
+    const auto speed = glm::dot(normal, direction);
+    if (speed == 0) {
+      if (distance > 0) {
+        return std::nullopt;
+      }
+      continue;
+    }
+
+    const auto fraction = -distance / speed;
+    if (speed < 0) {
+      entry = glm::max(entry, fraction);
+    } else {
+      exit = glm::min(exit, fraction);
+    }
+    if (entry > exit) {
+      return std::nullopt;
+    }
+  }
+  return entry;
+}
+
+ProjectionList projectOntoAxes(const VertexList &polygon, const VertexList &axes) {
+#ifdef GAME_ENGINE_USE_SSE
+  SDL_assert(!polygon.empty());
+  ProjectionList projections;
+  projections.resize(axes.size());
+
+  /* Project each vertex onto four axes at once. Comparisons are done in the same order as in the
+   * scalar implementation to produce identical results. */
+  for (size_t first_axis = 0; first_axis < axes.size(); first_axis += 4) {
+    const size_t axis_count = glm::min(axes.size() - first_axis, size_t{4});
+    alignas(16) float axes_x[4]{};
+    alignas(16) float axes_y[4]{};
+    for (size_t index = 0; index < axis_count; ++index) {
+      axes_x[index] = axes[first_axis + index].x;
+      axes_y[index] = axes[first_axis + index].y;
+    }
+    const __m128 axis_x = _mm_load_ps(axes_x);
+    const __m128 axis_y = _mm_load_ps(axes_y);
+
+    const auto project = [&](const glm::vec2 vertex) {
+      return _mm_add_ps(_mm_mul_ps(_mm_set1_ps(vertex.x), axis_x),
+                        _mm_mul_ps(_mm_set1_ps(vertex.y), axis_y));
+    };
+    __m128 min = project(polygon.front());
+    __m128 max = min;
+    for (size_t index = 1; index < polygon.size(); ++index) {
+      const __m128 dot_product = project(polygon[index]);
+      min = _mm_min_ps(dot_product, min);
+      max = _mm_max_ps(dot_product, max);
+    }
+
+    alignas(16) float mins[4];
+    alignas(16) float maxs[4];
+    _mm_store_ps(mins, min);
+    _mm_store_ps(maxs, max);
+    for (size_t index = 0; index < axis_count; ++index) {
+      projections[first_axis + index] = {mins[index], maxs[index]};
+    }
+  }
+  return projections;
+#else
+  return projectOntoAxesScalar(polygon, axes);
+#endif
+}
+
+ProjectionList projectOntoAxesScalar(const VertexList &polygon, const VertexList &axes) {
+  SDL_assert(!polygon.empty());
+  ProjectionList projections;
+  for (const auto axis : axes) {
+    const auto first_dot_product = polygon.front().x * axis.x + polygon.front().y * axis.y;
+    Projection projection{first_dot_product, first_dot_product};
+    for (size_t index = 1; index < polygon.size(); ++index) {
+      const auto dot_product = polygon[index].x * axis.x + polygon[index].y * axis.y;
+      projection.min = dot_product < projection.min ? dot_product : projection.min;
+      projection.max = dot_product > projection.max ? dot_product : projection.max;
+    }
+    projections.push_back(projection);
+  }
+  return projections;
+}
+
+size_t countEdges(const VertexList &polygon) {
   if (polygon.size() < 2) {
     return 0;
   }
@@ -16,8 +207,7 @@ size_t countEdges(const std::vector<glm::vec2> &polygon) {
   return polygon.size();
 }
 
-std::pair<glm::vec2, glm::vec2> getEdge(const std::vector<glm::vec2> &polygon,
-                                        const size_t edge_index) {
+std::pair<glm::vec2, glm::vec2> getEdge(const VertexList &polygon, const size_t edge_index) {
   SDL_assert(polygon.size() >= 2);
   if (edge_index == polygon.size() - 1) {
     return {polygon.back(), polygon.front()};
@@ -25,11 +215,9 @@ std::pair<glm::vec2, glm::vec2> getEdge(const std::vector<glm::vec2> &polygon,
   return {polygon[edge_index], polygon[edge_index + 1]};
 }
 
-void forEachEdge(const std::vector<glm::vec2> &polygon,
+void forEachEdge(const VertexList &polygon,
                  const std::function<void(glm::vec2 edge_start, glm::vec2 edge_end)> &function) {
-  const auto edge_count = countEdges(polygon);
-  for (size_t index = 0; index < edge_count; ++index) {
-    const auto [start, end] = getEdge(polygon, index);
+  for (const auto [start, end] : edges(polygon)) {
     function(start, end);
   }
 }
@@ -0,0 +1,128 @@
+/** @file
+ * Implements a bounding volume hierarchy.
+ */
+
+#include "GameEngine/Geometry/BVH.hpp"
+#include <algorithm>
+#include <array>
+#include <glm/common.hpp>
+#include <numeric>
+
+namespace {
+using namespace GameEngine::Geometry;
+
+/** Trees built by BVH::build() are balanced, so this is enough for any amount of entries which
+ * fits into memory. */
+constexpr size_t tree_depth_max = 64;
+
+BoundingBox merge(const BoundingBox &a, const BoundingBox &b) {
+  return {glm::min(a.min, b.min), glm::max(a.max, b.max)};
+}
+
+glm::vec2 getCenter(const BoundingBox &bounding_box) {
+  return (bounding_box.min + bounding_box.max) / 2.0f;
+}
+
+bool contains(const BoundingBox &bounding_box, const glm::vec2 point) {
+  return point.x >= bounding_box.min.x && point.x <= bounding_box.max.x &&
+         point.y >= bounding_box.min.y && point.y <= bounding_box.max.y;
+}
+} // namespace
+
+namespace GameEngine::Geometry {
+void BVH::build(const std::vector<BoundingBox> &bounding_boxes) {
+  nodes.clear();
+  leaf_of_entry.assign(bounding_boxes.size(), no_node);
+  if (bounding_boxes.empty()) {
+    return;
+  }
+
+  std::vector<size_t> entries(bounding_boxes.size());
+  std::iota(entries.begin(), entries.end(), 0);
+  nodes.reserve(bounding_boxes.size() * 2 - 1);
+  buildNode(entries, 0, entries.size(), no_node, bounding_boxes);
+}
+
+size_t BVH::size() const { return leaf_of_entry.size(); }
+
+void BVH::refit(const size_t index, const BoundingBox &bounding_box) {
+  auto node_index = leaf_of_entry[index];
+  nodes[node_index].bounding_box = bounding_box;
+  for (node_index = nodes[node_index].parent; node_index != no_node;
+       node_index = nodes[node_index].parent) {
+    auto &node = nodes[node_index];
+    node.bounding_box = merge(nodes[node.left].bounding_box, nodes[node.right].bounding_box);
+  }
+}
+
+void BVH::queryArea(const BoundingBox &area, std::vector<size_t> &result) const {
+  collectEntries([&](const BoundingBox &bounding_box) { return overlaps(area, bounding_box); },
+                 result);
+}
+
+void BVH::queryPoint(const glm::vec2 point, std::vector<size_t> &result) const {
+  collectEntries([&](const BoundingBox &bounding_box) { return contains(bounding_box, point); },
+                 result);
+}
+
+size_t BVH::buildNode(std::vector<size_t> &entries, const size_t begin, const size_t end,
+                      const size_t parent, const std::vector<BoundingBox> &bounding_boxes) {
+  const auto node_index = nodes.size();
+  const auto first_entry = entries[begin];
+  nodes.push_back({bounding_boxes[first_entry], parent, no_node, no_node, first_entry});
+  if (end - begin == 1) {
+    leaf_of_entry[first_entry] = node_index;
+    return node_index;
+  }
+
+  /* Split at the median along the axis in which the centers are spread the most. */
+  BoundingBox centers{getCenter(bounding_boxes[first_entry]),
+                      getCenter(bounding_boxes[first_entry])};
+  for (auto index = begin + 1; index < end; ++index) {
+    const auto center = getCenter(bounding_boxes[entries[index]]);
+    centers = merge(centers, {center, center});
+  }
+  const auto extent = centers.max - centers.min;
+  const int axis = extent.x >= extent.y ? 0 : 1;
+  const auto middle = begin + (end - begin) / 2;
+  std::nth_element(entries.begin() + begin, entries.begin() + middle, entries.begin() + end,
+                   [&](const size_t a, const size_t b) {
+                     const auto center_a = getCenter(bounding_boxes[a])[axis];
+                     const auto center_b = getCenter(bounding_boxes[b])[axis];
+                     return center_a < center_b || (center_a == center_b && a < b);
+                   });
+
+  const auto left = buildNode(entries, begin, middle, node_index, bounding_boxes);
+  const auto right = buildNode(entries, middle, end, node_index, bounding_boxes);
+  auto &node = nodes[node_index];
+  node.left = left;
+  node.right = right;
+  node.bounding_box = merge(nodes[left].bounding_box, nodes[right].bounding_box);
+  return node_index;
+}
+
+template <typename Predicate>
+void BVH::collectEntries(const Predicate &node_predicate, std::vector<size_t> &result) const {
+  result.clear();
+  if (nodes.empty()) {
+    return;
+  }
+
+  std::array<size_t, tree_depth_max> stack{};
+  size_t stack_size = 0;
+  stack[stack_size++] = 0;
+  while (stack_size > 0) {
+    const auto &node = nodes[stack[--stack_size]];
+    if (!node_predicate(node.bounding_box)) {
+      continue;
+    }
+    if (node.left == no_node) {
+      result.push_back(node.entry);
+      continue;
+    }
+    stack[stack_size++] = node.right;
+    stack[stack_size++] = node.left;
+  }
+  std::sort(result.begin(), result.end());
+}
+} // namespace GameEngine::Geometry
@@ -0,0 +1,153 @@
+/** @file
+ * Implements a uniform grid for finding objects close to each other.
+ */
+
+#include "GameEngine/Geometry/SpatialHashGrid.hpp"
+#include <algorithm>
+#include <cmath>
+#include <glm/common.hpp>
+#include <limits>
+
+namespace {
+/** Prevents degenerated grids where every entry covers an absurd amount of cells. */
+constexpr float cell_size_min = 0.01;
+
+/** Entries covering more cells are not stored in cells. Bounds the work of inserting and removing
+ * a single entry. */
+constexpr uint64_t entry_cell_count_max = 1024;
+
+/** @return Amount of cells in the given inclusive range of cell coordinates. Zero if the range is
+ * inverted. */
+uint64_t countCells(const int32_t min_x, const int32_t min_y, const int32_t max_x,
+                    const int32_t max_y) {
+  if (max_x < min_x || max_y < min_y) {
+    return 0;
+  }
+  return static_cast<uint64_t>(static_cast<int64_t>(max_x) - min_x + 1) *
+         static_cast<uint64_t>(static_cast<int64_t>(max_y) - min_y + 1);
+}
+
+int32_t toCellCoordinate(const float position, const float cell_size) {
+  /* Clamp to avoid undefined behaviour when converting huge values. NaN would pass the clamp, so
+   * it gets mapped to the cell at the origin. */
+  if (std::isnan(position)) {
+    return 0;
+  }
+  const float cell = glm::clamp(glm::floor(position / cell_size),
+                                static_cast<float>(std::numeric_limits<int32_t>::min() / 2),
+                                static_cast<float>(std::numeric_limits<int32_t>::max() / 2));
+  return static_cast<int32_t>(cell);
+}
+
+uint64_t toCellKey(const int32_t x, const int32_t y) {
+  return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+}
+} // namespace
+
+namespace GameEngine::Geometry {
+SpatialHashGrid::SpatialHashGrid(const float cell_size)
+    : cell_size{glm::max(cell_size, cell_size_min)} {}
+
+float SpatialHashGrid::getCellSize() const { return cell_size; }
+
+void SpatialHashGrid::insert(const size_t index, const BoundingBox &bounding_box) {
+  const auto range = computeCellRange(bounding_box);
+  if (index < entries.size() && entries[index].has_value()) {
+    const auto &old_range = *entries[index];
+    if (old_range.min_x == range.min_x && old_range.min_y == range.min_y &&
+        old_range.max_x == range.max_x && old_range.max_y == range.max_y) {
+      return;
+    }
+    remove(index);
+  }
+
+  if (index >= entries.size()) {
+    entries.resize(index + 1);
+  }
+  entries[index] = range;
+  if (isOversized(range)) {
+    oversized_entries.push_back(index);
+    return;
+  }
+  for (int32_t x = range.min_x; x <= range.max_x; ++x) {
+    for (int32_t y = range.min_y; y <= range.max_y; ++y) {
+      cells[toCellKey(x, y)].push_back(index);
+    }
+  }
+}
+
+void SpatialHashGrid::remove(const size_t index) {
+  if (index >= entries.size() || !entries[index].has_value()) {
+    return;
+  }
+
+  const auto range = *entries[index];
+  entries[index].reset();
+  if (isOversized(range)) {
+    oversized_entries.erase(std::find(oversized_entries.begin(), oversized_entries.end(), index));
+    return;
+  }
+  for (int32_t x = range.min_x; x <= range.max_x; ++x) {
+    for (int32_t y = range.min_y; y <= range.max_y; ++y) {
+      auto &cell = cells[toCellKey(x, y)];
+      cell.erase(std::find(cell.begin(), cell.end(), index));
+    }
+  }
+}
+
+void SpatialHashGrid::clear() {
+  cells.clear();
+  entries.clear();
+  oversized_entries.clear();
+}
+
+void SpatialHashGrid::query(const BoundingBox &bounding_box, std::vector<size_t> &result) const {
+  result.clear();
+
+  const auto range = computeCellRange(bounding_box);
+  for (const auto index : oversized_entries) {
+    const auto &entry_range = *entries[index];
+    if (entry_range.min_x <= range.max_x && entry_range.max_x >= range.min_x &&
+        entry_range.min_y <= range.max_y && entry_range.max_y >= range.min_y) {
+      result.push_back(index);
+    }
+  }
+
+  const auto range_cell_count = countCells(range.min_x, range.min_y, range.max_x, range.max_y);
+  if (range_cell_count > cells.size()) {
+    /* Huge areas, e.g. from zooming out very far, contain fewer stored cells than cell
+     * coordinates. */
+    for (const auto &[key, indices] : cells) {
+      const auto x = static_cast<int32_t>(static_cast<uint32_t>(key >> 32));
+      const auto y = static_cast<int32_t>(static_cast<uint32_t>(key));
+      if (x >= range.min_x && x <= range.max_x && y >= range.min_y && y <= range.max_y) {
+        result.insert(result.end(), indices.cbegin(), indices.cend());
+      }
+    }
+  } else {
+    for (int32_t x = range.min_x; x <= range.max_x; ++x) {
+      for (int32_t y = range.min_y; y <= range.max_y; ++y) {
+        const auto cell = cells.find(toCellKey(x, y));
+        if (cell != cells.end()) {
+          result.insert(result.end(), cell->second.cbegin(), cell->second.cend());
+        }
+      }
+    }
+  }
+
+  std::sort(result.begin(), result.end());
+  result.erase(std::unique(result.begin(), result.end()), result.end());
+}
+
+SpatialHashGrid::CellRange
+SpatialHashGrid::computeCellRange(const BoundingBox &bounding_box) const {
+  return {toCellCoordinate(bounding_box.min.x, cell_size),
+          toCellCoordinate(bounding_box.min.y, cell_size),
+          toCellCoordinate(bounding_box.max.x, cell_size),
+          toCellCoordinate(bounding_box.max.y, cell_size)};
+}
+
+bool SpatialHashGrid::isOversized(const CellRange &range) {
+  return countCells(range.min_x, range.min_y, range.max_x, range.max_y) > entry_cell_count_max;
+}
+} // namespace GameEngine::Geometry
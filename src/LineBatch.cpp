@@ -0,0 +1,52 @@
+/** @file
+ * Implements a class for drawing many lines with a single draw call.
+ */
+
+#include "GameEngine/LineBatch.hpp"
+#include "GameEngine/SDL2/Error.hpp"
+#include <glm/geometric.hpp>
+
+namespace GameEngine {
+void LineBatch::setColor(const SDL_Color color) { this->color = color; }
+
+void LineBatch::addLine(const glm::vec2 start, const glm::vec2 end) {
+  const auto length = glm::distance(start, end);
+  const auto direction = length > 0 ? (end - start) / length : glm::vec2{1, 0};
+
+  /* Extend the quad by half a pixel in each direction to close gaps between connected lines. */
+  const auto along = direction * 0.5f;
+  const glm::vec2 across{-along.y, along.x};
+  const int first_index = static_cast<int>(vertices.size());
+  for (const auto corner : {start - along + across, start - along - across, end + along - across,
+                            end + along + across}) {
+    vertices.push_back({{corner.x, corner.y}, color, {0, 0}});
+  }
+  for (const int offset : {0, 1, 2, 0, 2, 3}) {
+    indices.push_back(first_index + offset);
+  }
+}
+
+void LineBatch::addPolygon(const Geometry::VertexList &polygon) {
+  for (const auto [start, end] : Geometry::edges(polygon)) {
+    addLine(start, end);
+  }
+}
+
+void LineBatch::clear() {
+  vertices.clear();
+  indices.clear();
+}
+
+void LineBatch::render(SDL_Renderer *renderer) {
+  if (!indices.empty() &&
+      SDL_RenderGeometry(renderer, nullptr, vertices.data(), static_cast<int>(vertices.size()),
+                         indices.data(), static_cast<int>(indices.size())) != 0) {
+    throw SDL2::makeRuntimeError("Failed to render lines");
+  }
+  clear();
+}
+
+const std::vector<SDL_Vertex> &LineBatch::getVertices() const { return vertices; }
+
+const std::vector<int> &LineBatch::getIndices() const { return indices; }
+} // namespace GameEngine
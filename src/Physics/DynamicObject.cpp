@@ -4,9 +4,19 @@
 
 #include "GameEngine/Physics/DynamicObject.hpp"
 #include "GameEngine/Geometry.hpp"
+#include <array>
 #include <glm/gtx/projection.hpp>
 #include <glm/gtx/vector_angle.hpp>
 
+namespace {
+/** Objects moving less than this distance per tick while standing on the ground are considered to
+ * be resting. Also the minimal length of displacement vectors which wake sleeping objects. */
+constexpr float rest_distance_max = 0.005;
+
+/** Amount of ticks an object has to rest before it falls asleep. */
+constexpr uint16_t ticks_until_sleep = 30;
+} // namespace
+
 namespace GameEngine::Physics {
 DynamicObject::DynamicObject(std::initializer_list<glm::vec2> vertices)
     : bounding_polygon{vertices} {
@@ -30,8 +40,23 @@ glm::vec2 DynamicObject::getRightDirection() const {
 }
 
 void DynamicObject::update() {
+  const auto distance_moved = glm::distance(bounding_polygon.getPosition(),
+                                            state_at_previous_tick.bounding_polygon_position);
   storeCurrentStateAsPrevious();
 
+  if (ground_normal.has_value() && distance_moved < rest_distance_max) {
+    ticks_at_rest = glm::min<uint16_t>(ticks_at_rest + 1, ticks_until_sleep);
+  } else {
+    ticks_at_rest = 0;
+  }
+  if (ticks_at_rest == ticks_until_sleep) {
+    /* Keep the ground contact, since it can't be refreshed while sleeping. */
+    is_sleeping = true;
+    velocity = {};
+    state_at_previous_tick.velocity = velocity;
+    return;
+  }
+
   /* Align velocity parallel to ground when moving towards ground. */
   if (ground_normal.has_value() &&
       glm::angle(*ground_normal, glm::normalize(velocity)) > glm::half_pi<float>()) {
@@ -72,6 +97,13 @@ void DynamicObject::addVelocityOffset(const glm::vec2 offset) {
 const ConvexBoundingPolygon &DynamicObject::getBoundingPolygon() const { return bounding_polygon; }
 
 void DynamicObject::handleCollisionWith(Physics::Object &, const glm::vec2 displacement_vector) {
+  if (is_sleeping) {
+    /* Ignore objects resting on this one. */
+    if (glm::length(displacement_vector) < rest_distance_max) {
+      return;
+    }
+    wakeUp();
+  }
   addVelocityOffset(displacement_vector);
 
   const auto normalized_displacement_vector = glm::normalize(displacement_vector);
@@ -95,7 +127,14 @@ void DynamicObject::handleCollisionWith(Physics::Object &, const glm::vec2 displ
   }
 }
 
-void DynamicObject::render(SDL_Renderer *renderer, const Camera &camera,
+bool DynamicObject::isSleeping() const { return is_sleeping; }
+
+void DynamicObject::wakeUp() {
+  is_sleeping = false;
+  ticks_at_rest = 0;
+}
+
+void DynamicObject::render(LineBatch &line_batch, const Camera &camera,
                            const float integrator_tick_blend_value) const {
   const bool lerp_is_touching_ground = integrator_tick_blend_value < 0.5
                                            ? state_at_previous_tick.touching_ground
@@ -104,46 +143,45 @@ void DynamicObject::render(SDL_Renderer *renderer, const Camera &camera,
                                          ? state_at_previous_tick.touching_wall
                                          : direction_to_colliding_wall.has_value();
 
-  if (lerp_is_touching_ground) {
-    SDL_SetRenderDrawColor(renderer, 0, 255, 0, 255);
+  if (is_sleeping) {
+    line_batch.setColor({0, 127, 0, 255});
+  } else if (lerp_is_touching_ground) {
+    line_batch.setColor({0, 255, 0, 255});
   } else if (lerp_is_touching_wall) {
-    SDL_SetRenderDrawColor(renderer, 0, 0, 255, 255);
+    line_batch.setColor({0, 0, 255, 255});
   } else {
-    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
+    line_batch.setColor({255, 255, 255, 255});
   }
 
   auto lerp_polygon = bounding_polygon;
   lerp_polygon.setPosition(glm::mix(state_at_previous_tick.bounding_polygon_position,
                                     bounding_polygon.getPosition(), integrator_tick_blend_value));
-  Geometry::forEachEdge(lerp_polygon.getVertices(),
-                        [&](const glm::vec2 world_start, const glm::vec2 world_end) {
-                          const auto start = camera.toScreenCoordinate(world_start);
-                          const auto end = camera.toScreenCoordinate(world_end);
-                          SDL_RenderDrawLine(renderer, start.x, start.y, end.x, end.y);
-                        });
-
-  const auto position_on_screen = camera.toScreenCoordinate(lerp_polygon.getPosition());
+  line_batch.addPolygon(camera.toScreenCoordinates(lerp_polygon.getVertices()));
+
   const auto lerp_right_direction = glm::mix(state_at_previous_tick.right_direction,
                                              getRightDirection(), integrator_tick_blend_value);
-  const auto right_direction_on_screen_end =
-      camera.toScreenCoordinate(lerp_polygon.getPosition() + lerp_right_direction);
-
-  SDL_SetRenderDrawColor(renderer, 0, 255, 0, 255);
-  SDL_RenderDrawLine(renderer, position_on_screen.x, position_on_screen.y,
-                     right_direction_on_screen_end.x, right_direction_on_screen_end.y);
-
   const auto lerp_velocity =
       glm::mix(state_at_previous_tick.velocity, velocity, integrator_tick_blend_value);
-  const auto velocity_on_screen_end =
-      camera.toScreenCoordinate(lerp_polygon.getPosition() + lerp_velocity * 7.5f);
-  SDL_SetRenderDrawColor(renderer, 255, 0, 0, 255);
-  SDL_RenderDrawLine(renderer, position_on_screen.x, position_on_screen.y, velocity_on_screen_end.x,
-                     velocity_on_screen_end.y);
+
+  /* Position, end of the right direction and end of the velocity vector. */
+  const auto position = lerp_polygon.getPosition();
+  const std::array<glm::vec2, 3> markers{position, position + lerp_right_direction,
+                                         position + lerp_velocity * 7.5f};
+  std::array<glm::vec2, 3> markers_on_screen;
+  camera.toScreenCoordinates(markers.data(), markers.size(), markers_on_screen.data());
+
+  line_batch.setColor({0, 255, 0, 255});
+  line_batch.addLine(markers_on_screen[0], markers_on_screen[1]);
+  line_batch.setColor({255, 0, 0, 255});
+  line_batch.addLine(markers_on_screen[0], markers_on_screen[2]);
 }
 
 glm::vec2 DynamicObject::getVelocity() const { return velocity; }
 
-void DynamicObject::setVelocity(const glm::vec2 velocity) { this->velocity = velocity; }
+void DynamicObject::setVelocity(const glm::vec2 velocity) {
+  this->velocity = velocity;
+  wakeUp();
+}
 
 float DynamicObject::getGravity() const { return gravity; }
 
@@ -167,6 +205,18 @@ void DynamicObject::setAirFriction(const float air_friction) {
   this->air_friction = glm::clamp(air_friction, 0.0f, 1.0f);
 }
 
+uint32_t DynamicObject::getCollisionLayers() const { return collision_layers; }
+
+void DynamicObject::setCollisionLayers(const uint32_t collision_layers) {
+  this->collision_layers = collision_layers;
+}
+
+uint32_t DynamicObject::getCollisionMask() const { return collision_mask; }
+
+void DynamicObject::setCollisionMask(const uint32_t collision_mask) {
+  this->collision_mask = collision_mask;
+}
+
 void DynamicObject::storeCurrentStateAsPrevious() {
   state_at_previous_tick.touching_ground = ground_normal.has_value();
   state_at_previous_tick.touching_wall = direction_to_colliding_wall.has_value();
@@ -3,22 +3,34 @@
  */
 
 #include "GameEngine/Physics/Integrator.hpp"
+#include "GameEngine/Geometry/SpatialHashGrid.hpp"
+#include "GameEngine/Physics/StaticGeometry.hpp"
+#include "GameEngine/ThreadPool.hpp"
 #include <algorithm>
+#include <array>
+#include <limits>
+#include <utility>
 #include <glm/gtc/constants.hpp>
 #include <glm/gtx/projection.hpp>
 #include <glm/gtx/rotate_vector.hpp>
 
 using namespace std::chrono_literals;
+using namespace GameEngine;
 using namespace GameEngine::Physics;
 
 namespace {
-/** Maximal total length of velocity vector applicable per tick. */
-constexpr float velocity_length_max = 2.5;
+/** Lower limit for the substep length of each object. Keeps points and lines, which have no
+ * extent, moving in steps of reasonable length. */
+constexpr float substep_length_min = 0.05;
 
-/** For each tick the velocity vector is divided into substeps to prevent objects from clipping or
- * tunneling trough walls. This value is low enough to prevent a square with a size of 0.3x0.3
- * in-game units from falling trough a line. */
-constexpr float velocity_length_substep = 0.15;
+/** Amount by which swept objects move into static objects before being pushed out of them. Must be
+ * larger than zero to register the contact. */
+constexpr float contact_depth = 0.01;
+
+/** Limits the steps of a single object per tick, e.g. for objects which keep getting deflected
+ * between two walls. The last step sweeps the object towards its first contact, motion behind it
+ * gets dropped. */
+constexpr uint16_t steps_per_tick_max = 16;
 
 constexpr auto ticks_per_second = 60;
 
@@ -28,101 +40,1028 @@ constexpr auto tick_duration = std::chrono::microseconds{1s} / ticks_per_second;
  * framerates. */
 constexpr auto integration_time_max = tick_duration * 10;
 
+/** Moving objects wake up sleeping objects around them if they move faster than this value per
+ * tick. Must be larger than the velocity gained by gravity during a single tick, otherwise objects
+ * resting on each other would keep waking each other up. */
+constexpr float wake_up_velocity_min = 0.05;
+
+/** Slower objects wake up sleeping objects around them once they moved this far since they last
+ * did so. Catches objects sliding slowly away from objects resting on them. Must be larger than
+ * the distance objects resting on each other move due to rounding errors. */
+constexpr float wake_up_distance_min = 0.005;
+
+/** Amount of objects updated by a single task in parallel mode. */
+constexpr size_t objects_per_update_task = 64;
+
+#ifdef GAME_ENGINE_ENABLE_STATISTICS
+constexpr bool statistics_enabled = true;
+#else
+constexpr bool statistics_enabled = false;
+#endif
+
+/** Increase the given statistics counter. Compiles to nothing if statistics are disabled. */
+void count(size_t &counter, const size_t amount = 1) {
+  if constexpr (statistics_enabled) {
+    counter += amount;
+  }
+}
+
+/** Call the given function and add the time it took to the given duration. Doesn't query the clock
+ * if statistics are disabled. */
+template <typename Function> void measure(std::chrono::nanoseconds &duration, Function &&function) {
+  if constexpr (statistics_enabled) {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    duration += std::chrono::steady_clock::now() - start;
+  } else {
+    function();
+  }
+}
+
 /* Represents an object during a substep. */
 struct UnprocessedObject {
-  Object *object;
-  glm::vec2 direction;
-  float remaining_velocity_length;
+  size_t index; /**< Position of the object in the object list. */
+  glm::vec2 remaining_motion;
+  uint16_t step_count;
+};
+
+/** Separating axes found by the most recent collision checks of a moving object against its
+ * neighbours. Only used for speeding up collision checks, so outdated entries are harmless. */
+class ContactCache {
+public:
+  /** Used instead of a shape index for objects which are not static geometry. */
+  static constexpr size_t no_shape = std::numeric_limits<size_t>::max();
+
+  /** @return Hint for checking the owner of this cache against the given object, or against a
+   * single shape of the given static geometry object. Replaces the oldest entry if the given
+   * object or shape is not cached yet. */
+  ConvexBoundingPolygon::SeparatingAxisHint &find(const size_t other_index,
+                                                   const size_t shape_index = no_shape) {
+    for (auto &entry : entries) {
+      if (entry.other_index == other_index && entry.shape_index == shape_index) {
+        return entry.hint;
+      }
+    }
+    auto &entry = entries[next_entry];
+    next_entry = (next_entry + 1) % entries.size();
+    entry = {other_index, shape_index, {}};
+    return entry.hint;
+  }
+
+private:
+  struct Entry {
+    size_t other_index = std::numeric_limits<size_t>::max();
+    size_t shape_index = no_shape;
+    ConvexBoundingPolygon::SeparatingAxisHint hint;
+  };
+
+  /** Enough for a box surrounded by its neighbours in a stack. */
+  std::array<Entry, 6> entries{};
+  size_t next_entry = 0;
+};
+
+/** Collision reported to a static object after all islands were processed. */
+struct StaticCollision {
+  size_t static_index;
+  size_t other_index;
+  glm::vec2 displacement_vector;
+};
+
+/** Per-object data stored in contiguous arrays, indexed by the position of each object in the
+ * object list. Allows iterating and rejecting collision candidates without touching the objects
+ * themselves. */
+struct BodyTable {
+  std::vector<Object *> objects;
+  std::vector<glm::vec2> velocities;
+  std::vector<Geometry::BoundingBox> bounding_boxes;
+
+  /** Contains 1 for objects with at least one vertex, 0 otherwise. */
+  std::vector<uint8_t> is_collidable;
+
+  std::vector<BodyType> body_types;
+  std::vector<uint32_t> collision_layers;
+  std::vector<uint32_t> collision_masks;
+
+  /** Contains 1 for objects which are skipped until they get woken up, 0 otherwise. */
+  std::vector<uint8_t> is_sleeping;
+
+  /** Lower left corner of each objects bounding box at the beginning of the current tick. */
+  std::vector<glm::vec2> positions;
+
+  /** Lower left corner of each objects bounding box when it last woke up sleeping objects around
+   * it. */
+  std::vector<glm::vec2> wake_up_positions;
+
+  /** Distance each moving object may cover in a single step during the current tick. Objects
+   * moving less than this get pushed out of everything they overlap afterwards, faster objects get
+   * swept towards their first contact. Also the amount by which objects may move into other moving
+   * objects before being pushed out of them. Derived from the smallest extent of each object. */
+  std::vector<float> substep_lengths;
+
+  /** Only modified while processing the owning object, which allows sharing the other objects of
+   * each pair between islands. */
+  std::vector<ContactCache> contacts;
+};
+
+/** Group of moving objects which may only collide with each other and with static objects during
+ * the current tick. Used in parallel mode. */
+struct Island {
+  /** Sorted indices of all moving objects in this island. */
+  std::vector<size_t> members;
+
+  std::vector<size_t> collision_candidates;
+  std::vector<size_t> shape_candidates;
+  std::vector<UnprocessedObject> unprocessed_objects;
+
+  /** Collisions with static objects during the current tick, in the order they occurred. */
+  std::vector<StaticCollision> static_collisions;
+
+  /** Counters of the current tick, merged into the integrators statistics afterwards. */
+  Integrator::Statistics statistics;
+};
+
+/** Contents of Integrator::TickState, which can't be named outside of the integrator. */
+struct TickStateData {
+  BodyTable bodies;
+
+  /** Reused for passing owned objects to the overload of integrate() taking raw pointers. */
+  std::vector<Object *> object_pointers;
+
+  /** Contains the bounding boxes of all collidable objects. */
+  Geometry::SpatialHashGrid broadphase{2};
+
+  /** Reused for each broadphase query to avoid allocations. */
+  std::vector<size_t> collision_candidates;
+  std::vector<size_t> shape_candidates;
+  std::vector<UnprocessedObject> unprocessed_objects;
+
+  /** Indices of all objects providing static geometry. Their shapes are not part of the
+   * broadphase. */
+  std::vector<size_t> static_geometries;
+
+  /** Indices of all objects which are not static, in ascending order. */
+  std::vector<size_t> moving_objects;
+
+  /** Positions passed to Integrator::invalidate() since the last integrate() call. */
+  std::vector<size_t> invalidated_objects;
+
+  /** Null if ticks are processed serially. */
+  std::unique_ptr<ThreadPool> thread_pool;
+
+  /** Contains the regions which moving objects may cover during the current tick and the
+   * bounding boxes of all static objects. Used for building islands and for finding collision
+   * candidates inside them, because it stays valid while the islands get processed. */
+  Geometry::SpatialHashGrid island_broadphase{2};
+  std::vector<Geometry::BoundingBox> regions;
+
+  /** Union-find forest over all objects, where each tree represents an island. */
+  std::vector<size_t> island_parents;
+  std::vector<size_t> island_of_root;
+
+  /** Island of each moving object during the current tick. */
+  std::vector<size_t> island_of_object;
+
+  /** Only the first island_count islands are used by the current tick. The others are kept to
+   * reuse their memory. */
+  std::vector<Island> islands;
+  size_t island_count = 0;
+
+  /** Largest distance moved by an object during the last tick. */
+  float largest_motion = 0;
 };
 
-/** Apply a single velocity/collision substep to the given object.
+/** State used for moving a set of objects. */
+struct TickContext {
+  BodyTable &bodies;
+
+  /** Contains the bounding boxes of all collidable objects. Will be kept up to date if not null. */
+  Geometry::SpatialHashGrid *broadphase;
+
+  /** If not null, the island broadphase of the tick state, which takes precedence over the
+   * broadphase. Only the members of the island with the given index and static objects will be
+   * found in it. */
+  const Geometry::SpatialHashGrid *island_broadphase;
+  const std::vector<size_t> *island_of_object;
+  size_t island_index;
+
+  /** Reused for each broadphase query. */
+  std::vector<size_t> &collision_candidates;
+
+  /** Indices of all objects providing static geometry. */
+  const std::vector<size_t> &static_geometries;
+
+  /** Reused for each query of static geometry. */
+  std::vector<size_t> &shape_candidates;
+
+  /** If not null, collisions with static objects get collected here instead of being reported
+   * immediately. Static objects are shared between islands, so this prevents concurrent calls. */
+  std::vector<StaticCollision> *static_collisions;
+
+  Integrator::Statistics &statistics;
+};
+
+/** @return True if the given object never moves. */
+bool isStatic(const BodyTable &bodies, const size_t index) {
+  return bodies.body_types[index] == BodyType::Static;
+}
+
+/** @return True if the given object gets stopped and pushed around by other objects. */
+bool isDynamic(const BodyTable &bodies, const size_t index) {
+  return bodies.body_types[index] == BodyType::Dynamic;
+}
+
+/** @return True if collisions between both objects need to be checked. Requires at least one
+ * dynamic object, which can respond to the collision, and matching collision layers. */
+bool canCollide(const BodyTable &bodies, const size_t a, const size_t b) {
+  return (isDynamic(bodies, a) || isDynamic(bodies, b)) &&
+         (bodies.collision_layers[a] & bodies.collision_masks[b]) != 0 &&
+         (bodies.collision_layers[b] & bodies.collision_masks[a]) != 0;
+}
+
+/** Report a collision to the other object of a colliding pair, either immediately or after all
+ * islands were processed if the other object is static. */
+void reportCollisionToOther(TickContext &context, const size_t other_index, const size_t index,
+                            const glm::vec2 displacement_vector) {
+  auto &bodies = context.bodies;
+  if (context.static_collisions != nullptr && isStatic(bodies, other_index)) {
+    context.static_collisions->push_back({other_index, index, displacement_vector});
+  } else {
+    bodies.objects[other_index]->handleCollisionWith(*bodies.objects[index], displacement_vector);
+  }
+}
+
+/** Refresh the bounding box of the given object in the body table and the broadphase. Objects
+ * without vertices can't collide and won't be indexed. */
+void updateBoundingBox(TickContext &context, const size_t index) {
+  const auto &polygon = context.bodies.objects[index]->getBoundingPolygon();
+  if (polygon.getVertices().empty()) {
+    context.bodies.is_collidable[index] = 0;
+    if (context.broadphase != nullptr) {
+      context.broadphase->remove(index);
+    }
+    return;
+  }
+  context.bodies.is_collidable[index] = 1;
+  context.bodies.bounding_boxes[index] = polygon.getBoundingBox();
+  if (context.broadphase != nullptr) {
+    context.broadphase->insert(index, polygon.getBoundingBox());
+  }
+}
+
+/** Fill the contexts collision candidates with the indices of all objects which may overlap the
+ * given area. */
+void findObjectsInArea(TickContext &context, const Geometry::BoundingBox &area) {
+  auto &candidates = context.collision_candidates;
+  if (context.island_broadphase == nullptr) {
+    context.broadphase->query(area, candidates);
+    return;
+  }
+
+  /* Moving objects are stored with the whole region they may cover during this tick. */
+  const auto &bodies = context.bodies;
+  context.island_broadphase->query(area, candidates);
+  const auto is_outside_of_island = [&](const size_t other_index) {
+    if (isStatic(bodies, other_index)) {
+      return false;
+    }
+    return (*context.island_of_object)[other_index] != context.island_index ||
+           bodies.is_collidable[other_index] == 0 ||
+           !Geometry::overlaps(area, bodies.bounding_boxes[other_index]);
+  };
+  candidates.erase(std::remove_if(candidates.begin(), candidates.end(), is_outside_of_island),
+                   candidates.end());
+}
+
+/** Fill the contexts collision candidates with the indices of all objects which may collide with
+ * the given object. */
+void findCollisionCandidates(TickContext &context, const size_t index) {
+  if (context.bodies.is_collidable[index] == 0) {
+    context.collision_candidates.clear();
+    return;
+  }
+  findObjectsInArea(context, context.bodies.bounding_boxes[index]);
+}
+
+/** Remove the part of the given motion which points into the obstacle that caused the given
+ * displacement vector. Lets objects slide along static objects instead of pushing into them
+ * again. */
+void deflectMotion(glm::vec2 &motion, const glm::vec2 displacement_vector) {
+  const auto normal = glm::normalize(displacement_vector);
+  const auto speed_towards_obstacle = glm::dot(motion, normal);
+  if (speed_towards_obstacle < 0) {
+    motion -= normal * speed_towards_obstacle;
+  }
+}
+
+/** @return Area covered by the given bounding box while moving by the given motion. */
+Geometry::BoundingBox computeSweptArea(const Geometry::BoundingBox &bounding_box,
+                                       const glm::vec2 motion) {
+  return {glm::min(bounding_box.min, bounding_box.min + motion),
+          glm::max(bounding_box.max, bounding_box.max + motion)};
+}
+
+/** @return Fraction of the remaining motion of the given kinematic object which it can move
+ * without passing through dynamic objects. Steps are no longer than the substep length of the
+ * kinematic object and of all dynamic objects in its way, so these get pushed out in the direction
+ * of motion. Kinematic objects never get stopped, so their last step covers all remaining
+ * motion. */
+float computeKinematicStepFraction(TickContext &context,
+                                   const UnprocessedObject &unprocessed_object,
+                                   const bool is_last_step) {
+  if (is_last_step) {
+    return 1;
+  }
+  const auto index = unprocessed_object.index;
+  const auto motion = unprocessed_object.remaining_motion;
+
+  const auto swept_area = computeSweptArea(context.bodies.bounding_boxes[index], motion);
+  auto step_length = context.bodies.substep_lengths[index];
+  findObjectsInArea(context, swept_area);
+  for (const auto other_index : context.collision_candidates) {
+    if (other_index != index && canCollide(context.bodies, index, other_index) &&
+        Geometry::overlaps(swept_area, context.bodies.bounding_boxes[other_index])) {
+      step_length = glm::min(step_length, context.bodies.substep_lengths[other_index]);
+    }
+  }
+  return glm::min(step_length / glm::length(motion), 1.0f);
+}
+
+/** @return Fraction of the remaining motion of the given object which it can move before touching
+ * the first obstacle in its way. Steps are never shorter than a substep, which guarantees progress
+ * for objects which already overlap others, unless it is the last step of the object during this
+ * tick. Only dynamic objects get stopped by obstacles. */
+float computeStepFraction(TickContext &context, const UnprocessedObject &unprocessed_object,
+                          const bool is_last_step) {
+  const auto index = unprocessed_object.index;
+  const auto motion = unprocessed_object.remaining_motion;
+  const auto motion_length = glm::length(motion);
+  const auto substep_length = context.bodies.substep_lengths[index];
+  if (context.bodies.is_collidable[index] == 0 || motion_length <= substep_length) {
+    return 1;
+  }
+  if (!isDynamic(context.bodies, index)) {
+    return computeKinematicStepFraction(context, unprocessed_object, is_last_step);
+  }
+
+  const auto &polygon = context.bodies.objects[index]->getBoundingPolygon();
+  const auto swept_area = computeSweptArea(context.bodies.bounding_boxes[index], motion);
+  float fraction = 1;
+  const auto sweep = [&](const ConvexBoundingPolygon &obstacle, const float penetration_depth) {
+    const auto time_of_impact = polygon.computeTimeOfImpact(obstacle, motion, penetration_depth);
+    count(context.statistics.narrowphase_tests);
+    if (time_of_impact) {
+      fraction = glm::min(fraction, *time_of_impact);
+    }
+  };
+
+  findObjectsInArea(context, swept_area);
+  for (const auto other_index : context.collision_candidates) {
+    if (other_index == index || !canCollide(context.bodies, index, other_index) ||
+        !Geometry::overlaps(swept_area, context.bodies.bounding_boxes[other_index])) {
+      continue;
+    }
+    sweep(context.bodies.objects[other_index]->getBoundingPolygon(),
+          isDynamic(context.bodies, other_index)
+              ? glm::min(substep_length, context.bodies.substep_lengths[other_index])
+              : contact_depth);
+  }
+  for (const auto geometry_index : context.static_geometries) {
+    if (!canCollide(context.bodies, index, geometry_index)) {
+      continue;
+    }
+    const auto &geometry = *context.bodies.objects[geometry_index]->getStaticGeometry();
+    geometry.queryArea(swept_area, context.shape_candidates);
+    for (const auto shape_index : context.shape_candidates) {
+      sweep(geometry.getShapes()[shape_index], contact_depth);
+    }
+  }
+  return is_last_step ? fraction : glm::max(fraction, substep_length / motion_length);
+}
+
+/** Resolve collisions between the given object and the shapes of all static geometry objects. */
+void collideWithStaticGeometry(TickContext &context, UnprocessedObject &unprocessed_object) {
+  const auto index = unprocessed_object.index;
+  auto &object = *context.bodies.objects[index];
+  for (const auto geometry_index : context.static_geometries) {
+    if (!canCollide(context.bodies, index, geometry_index)) {
+      continue;
+    }
+    auto &geometry_object = *context.bodies.objects[geometry_index];
+    const auto &geometry = *geometry_object.getStaticGeometry();
+    const auto &shapes = geometry.getShapes();
+
+    auto &candidates = context.shape_candidates;
+    candidates.clear();
+    if (context.bodies.is_collidable[index] != 0) {
+      geometry.queryArea(context.bodies.bounding_boxes[index], candidates);
+    }
+    size_t candidate = 0;
+    while (candidate < candidates.size()) {
+      const auto shape_index = candidates[candidate];
+      ++candidate;
+      const auto &shape = shapes[shape_index];
+      if (!Geometry::overlaps(context.bodies.bounding_boxes[index], shape.getBoundingBox())) {
+        continue;
+      }
+
+      const auto displacement_vector = object.getBoundingPolygon().collidesWith(
+          shape, context.bodies.contacts[index].find(geometry_index, shape_index));
+      count(context.statistics.narrowphase_tests);
+      if (!displacement_vector) {
+        continue;
+      }
+      count(context.statistics.collisions);
+      object.handleCollisionWith(geometry_object, *displacement_vector);
+      reportCollisionToOther(context, geometry_index, index, -*displacement_vector);
+      deflectMotion(unprocessed_object.remaining_motion, *displacement_vector);
+
+      updateBoundingBox(context, index);
+      candidates.clear();
+      if (context.bodies.is_collidable[index] != 0) {
+        geometry.queryArea(context.bodies.bounding_boxes[index], candidates);
+      }
+      candidate = std::upper_bound(candidates.cbegin(), candidates.cend(), shape_index) -
+                  candidates.cbegin();
+    }
+  }
+}
+
+/** Move the given object towards its next contact and resolve all collisions at the new position.
  *
  * @param unprocessed_object Object which should be moved by its velocity.
- * @param objects All other objects which may collide with the given moving object.
+ * @param context Contains all other objects which may collide with the given moving object.
  *
  * @return True if the object was processed completely. False if some unapplied velocity is
  * remaining.
  */
-bool processObject(UnprocessedObject &unprocessed_object,
-                   const std::vector<std::unique_ptr<Object>> &objects) {
-  const auto length_of_this_step =
-      glm::min(unprocessed_object.remaining_velocity_length, velocity_length_substep);
-  unprocessed_object.object->addVelocityOffset(unprocessed_object.direction * length_of_this_step);
-
-  for (const auto &other_object : objects) {
-    if (other_object.get() == unprocessed_object.object) {
+bool processObject(UnprocessedObject &unprocessed_object, TickContext &context) {
+  const auto index = unprocessed_object.index;
+  auto &object = *context.bodies.objects[index];
+  const auto is_last_step = unprocessed_object.step_count + 1 >= steps_per_tick_max;
+  const auto step = unprocessed_object.remaining_motion *
+                    computeStepFraction(context, unprocessed_object, is_last_step);
+  object.addVelocityOffset(step);
+  unprocessed_object.remaining_motion -= step;
+  ++unprocessed_object.step_count;
+  updateBoundingBox(context, index);
+  count(context.statistics.substeps);
+
+  findCollisionCandidates(context, index);
+  size_t candidate = 0;
+  while (candidate < context.collision_candidates.size()) {
+    const auto other_index = context.collision_candidates[candidate];
+    ++candidate;
+    if (other_index == index || !canCollide(context.bodies, index, other_index) ||
+        !Geometry::overlaps(context.bodies.bounding_boxes[index],
+                            context.bodies.bounding_boxes[other_index])) {
       continue;
     }
 
-    const auto displacement_vector = unprocessed_object.object->getBoundingPolygon().collidesWith(
-        other_object->getBoundingPolygon());
+    auto &other_object = *context.bodies.objects[other_index];
+    const auto displacement_vector = object.getBoundingPolygon().collidesWith(
+        other_object.getBoundingPolygon(), context.bodies.contacts[index].find(other_index));
+    count(context.statistics.narrowphase_tests);
     if (!displacement_vector) {
       continue;
     }
-    unprocessed_object.object->handleCollisionWith(*other_object, *displacement_vector);
-    other_object->handleCollisionWith(*unprocessed_object.object, -*displacement_vector);
+    count(context.statistics.collisions);
+    object.handleCollisionWith(other_object, *displacement_vector);
+    reportCollisionToOther(context, other_index, index, -*displacement_vector);
+    if (isDynamic(context.bodies, index) && !isDynamic(context.bodies, other_index)) {
+      deflectMotion(unprocessed_object.remaining_motion, *displacement_vector);
+    }
+
+    /* Both objects may have been moved out of each other. Static objects never move and may be
+     * shared between islands, so they are left untouched. Continue with the objects following the
+     * current one at the new position, like a linear scan over all objects would. */
+    updateBoundingBox(context, index);
+    if (!isStatic(context.bodies, other_index)) {
+      updateBoundingBox(context, other_index);
+    }
+    findCollisionCandidates(context, index);
+    candidate = std::upper_bound(context.collision_candidates.cbegin(),
+                                 context.collision_candidates.cend(), other_index) -
+                context.collision_candidates.cbegin();
+  }
+  collideWithStaticGeometry(context, unprocessed_object);
+
+  if (glm::length(unprocessed_object.remaining_motion) <= glm::epsilon<float>()) {
+    return true;
+  }
+  if (is_last_step) {
+    count(context.statistics.dropped_motions);
+    return true;
+  }
+  return false;
+}
+
+/** @return The given object prepared for its first substep. */
+UnprocessedObject makeUnprocessedObject(const BodyTable &bodies, const size_t index) {
+  return {index, bodies.velocities[index], 0};
+}
+
+/** Move the given objects by their velocity, one substep per object at a time.
+ *
+ * @param indices Sorted indices of the objects to move.
+ * @param unprocessed_objects Reused for tracking objects with remaining velocity.
+ */
+void moveObjects(TickContext &context, const std::vector<size_t> &indices,
+                 std::vector<UnprocessedObject> &unprocessed_objects) {
+  unprocessed_objects.clear();
+  for (const auto index : indices) {
+    if (context.bodies.is_sleeping[index] != 0) {
+      continue;
+    }
+    auto unprocessed_object = makeUnprocessedObject(context.bodies, index);
+    if (!processObject(unprocessed_object, context)) {
+      unprocessed_objects.push_back(unprocessed_object);
+    }
   }
 
-  unprocessed_object.remaining_velocity_length -= length_of_this_step;
-  return unprocessed_object.remaining_velocity_length <= glm::epsilon<float>();
+  while (!unprocessed_objects.empty()) {
+    count(context.statistics.unprocessed_object_iterations, unprocessed_objects.size());
+
+    /* Replace finished objects with the last object in the list, which wasn't processed during
+     * this pass yet. */
+    size_t position = 0;
+    while (position < unprocessed_objects.size()) {
+      if (processObject(unprocessed_objects[position], context)) {
+        unprocessed_objects[position] = unprocessed_objects.back();
+        unprocessed_objects.pop_back();
+      } else {
+        ++position;
+      }
+    }
+  }
 }
 
-void applyTick(const std::vector<std::unique_ptr<Object>> &objects) {
-  for (const auto &object : objects) {
-    object->update();
+/** Call update() on all moving objects which are not sleeping. Static objects never change. */
+void updateObjects(TickStateData &state) {
+  auto &objects = state.bodies.objects;
+  const auto &is_sleeping = state.bodies.is_sleeping;
+  const auto &moving_objects = state.moving_objects;
+  if (!state.thread_pool) {
+    for (const auto index : moving_objects) {
+      if (is_sleeping[index] == 0) {
+        objects[index]->update();
+      }
+    }
+    return;
   }
 
-  std::vector<UnprocessedObject> unprocessed_objects{};
+  const auto task_count =
+      (moving_objects.size() + objects_per_update_task - 1) / objects_per_update_task;
+  state.thread_pool->forEach(task_count, [&](const size_t task_index) {
+    const auto begin = task_index * objects_per_update_task;
+    const auto end = std::min(begin + objects_per_update_task, moving_objects.size());
+    for (auto position = begin; position < end; ++position) {
+      const auto index = moving_objects[position];
+      if (is_sleeping[index] == 0) {
+        objects[index]->update();
+      }
+    }
+  });
+}
 
-  for (const auto &object : objects) {
-    const auto remaining_velocity_length =
-        glm::min(glm::length(object->getVelocity()), velocity_length_max);
+/** @return Area which the given object covers while moving by its velocity, including some margin
+ * for being pushed around by other objects. */
+Geometry::BoundingBox computeRegion(const BodyTable &bodies, const size_t index) {
+  const auto &bounding_box = bodies.bounding_boxes[index];
+  const auto velocity = bodies.velocities[index];
+  const glm::vec2 margin{bodies.substep_lengths[index]};
+  return {glm::min(bounding_box.min, bounding_box.min + velocity) - margin,
+          glm::max(bounding_box.max, bounding_box.max + velocity) + margin};
+}
 
-    /* Don't normalize vectors with zero length. */
-    const auto direction = remaining_velocity_length > glm::epsilon<float>()
-                               ? glm::normalize(object->getVelocity())
-                               : glm::vec2{};
+/** @return Same as computeRegion(), but also covers all paths of objects which get deflected by
+ * static objects. Their total distance moved never exceeds the length of their velocity. */
+Geometry::BoundingBox computeReachableRegion(const BodyTable &bodies, const size_t index) {
+  const auto &bounding_box = bodies.bounding_boxes[index];
+  const glm::vec2 reach{glm::length(bodies.velocities[index]) + bodies.substep_lengths[index]};
+  return {bounding_box.min - reach, bounding_box.max + reach};
+}
 
-    UnprocessedObject unprocessed_object{object.get(), direction, remaining_velocity_length};
-    if (!processObject(unprocessed_object, objects)) {
-      unprocessed_objects.push_back(unprocessed_object);
+/** Wake up sleeping objects which are close to objects that are moving fast or moved noticeably
+ * since they last woke up objects around them. Prevents sleeping objects from floating in the air
+ * after their ground moved away, regardless of its speed. Woken objects get updated immediately. */
+void wakeUpObjectsNearMovingObjects(TickStateData &state) {
+  auto &bodies = state.bodies;
+  for (const auto index : state.moving_objects) {
+    if (bodies.is_sleeping[index] != 0 || bodies.is_collidable[index] == 0) {
+      continue;
+    }
+    const auto position = bodies.positions[index];
+    if (glm::length(bodies.velocities[index]) < wake_up_velocity_min &&
+        glm::distance(position, bodies.wake_up_positions[index]) < wake_up_distance_min) {
+      continue;
+    }
+    bodies.wake_up_positions[index] = position;
+
+    const auto region = computeRegion(bodies, index);
+    state.broadphase.query(region, state.collision_candidates);
+    for (const auto other_index : state.collision_candidates) {
+      auto &other_object = *bodies.objects[other_index];
+      if (bodies.is_sleeping[other_index] == 0 ||
+          !Geometry::overlaps(region, bodies.bounding_boxes[other_index])) {
+        continue;
+      }
+      other_object.wakeUp();
+      if (!other_object.isSleeping()) {
+        bodies.is_sleeping[other_index] = 0;
+        other_object.update();
+        bodies.velocities[other_index] = other_object.getVelocity();
+      }
     }
   }
+}
 
-  while (!unprocessed_objects.empty()) {
-    unprocessed_objects.erase(std::remove_if(unprocessed_objects.begin(), unprocessed_objects.end(),
-                                             [&](UnprocessedObject &unprocessed_object) {
-                                               return processObject(unprocessed_object, objects);
-                                             }),
-                              unprocessed_objects.end());
+size_t findIslandRoot(std::vector<size_t> &parents, size_t index) {
+  while (parents[index] != index) {
+    parents[index] = parents[parents[index]];
+    index = parents[index];
+  }
+  return index;
+}
+
+/** Merge the islands of both objects. The smallest index always becomes the root, which makes
+ * the resulting islands independent of the order of merges. */
+void mergeIslands(std::vector<size_t> &parents, const size_t a, const size_t b) {
+  const auto root_a = findIslandRoot(parents, a);
+  const auto root_b = findIslandRoot(parents, b);
+  if (root_a < root_b) {
+    parents[root_b] = root_a;
+  } else {
+    parents[root_a] = root_b;
+  }
+}
+
+/** Group all moving objects into islands of objects whose regions overlap. Islands are ordered by
+ * their smallest member. Static objects are kept in the island broadphase since their insertion. */
+void buildIslands(TickStateData &state) {
+  auto &bodies = state.bodies;
+  auto &parents = state.island_parents;
+  const auto object_count = bodies.objects.size();
+  const auto is_island_member = [&](const size_t index) {
+    return !isStatic(bodies, index) && bodies.is_collidable[index] != 0;
+  };
+
+  constexpr auto no_island = std::numeric_limits<size_t>::max();
+  state.regions.resize(object_count);
+  parents.resize(object_count);
+  state.island_of_root.resize(object_count);
+  state.island_of_object.resize(object_count);
+  for (const auto index : state.moving_objects) {
+    parents[index] = index;
+    state.island_of_root[index] = no_island;
+    if (is_island_member(index)) {
+      state.regions[index] = computeReachableRegion(bodies, index);
+      state.island_broadphase.insert(index, state.regions[index]);
+    } else {
+      state.island_broadphase.remove(index);
+    }
+  }
+
+  for (const auto index : state.moving_objects) {
+    if (!is_island_member(index)) {
+      continue;
+    }
+    state.island_broadphase.query(state.regions[index], state.collision_candidates);
+    for (const auto other_index : state.collision_candidates) {
+      if (other_index > index && is_island_member(other_index) &&
+          Geometry::overlaps(state.regions[index], state.regions[other_index])) {
+        mergeIslands(parents, index, other_index);
+      }
+    }
+  }
+
+  state.island_count = 0;
+  for (const auto index : state.moving_objects) {
+    auto &island_index = state.island_of_root[findIslandRoot(parents, index)];
+    if (island_index == no_island) {
+      island_index = state.island_count;
+      ++state.island_count;
+      if (island_index == state.islands.size()) {
+        state.islands.emplace_back();
+      }
+      state.islands[island_index].members.clear();
+    }
+    state.islands[island_index].members.push_back(index);
+    state.island_of_object[index] = island_index;
+  }
+}
+
+/** Add the counters of an island to the given statistics. */
+void addCounters(Integrator::Statistics &statistics, const Integrator::Statistics &island) {
+  statistics.substeps += island.substeps;
+  statistics.narrowphase_tests += island.narrowphase_tests;
+  statistics.collisions += island.collisions;
+  statistics.unprocessed_object_iterations += island.unprocessed_object_iterations;
+  statistics.dropped_motions += island.dropped_motions;
+}
+
+/** Move all objects which are not sleeping, either serially or in islands. */
+void moveAllObjects(TickStateData &state, TickContext &context) {
+  if (!state.thread_pool) {
+    moveObjects(context, state.moving_objects, state.unprocessed_objects);
+    return;
+  }
+
+  /* Islands only see their own members and static objects, so they can be processed
+   * concurrently without sharing mutable state. The broadphase gets updated and collisions get
+   * reported to static objects afterwards, in the order of the islands. */
+  auto &bodies = state.bodies;
+  buildIslands(state);
+  state.thread_pool->forEach(state.island_count, [&](const size_t island_index) {
+    auto &island = state.islands[island_index];
+    island.statistics = {};
+    island.static_collisions.clear();
+    TickContext island_context{bodies,
+                               nullptr,
+                               &state.island_broadphase,
+                               &state.island_of_object,
+                               island_index,
+                               island.collision_candidates,
+                               state.static_geometries,
+                               island.shape_candidates,
+                               &island.static_collisions,
+                               island.statistics};
+    moveObjects(island_context, island.members, island.unprocessed_objects);
+  });
+  for (size_t island_index = 0; island_index < state.island_count; ++island_index) {
+    const auto &island = state.islands[island_index];
+    addCounters(context.statistics, island.statistics);
+    for (const auto index : island.members) {
+      if (bodies.is_collidable[index] != 0) {
+        state.broadphase.insert(index, bodies.bounding_boxes[index]);
+      } else {
+        state.broadphase.remove(index);
+      }
+    }
+    for (const auto &collision : island.static_collisions) {
+      bodies.objects[collision.static_index]->handleCollisionWith(
+          *bodies.objects[collision.other_index], collision.displacement_vector);
+    }
+  }
+}
+
+/** Read the properties of an object which appeared at the given position of the object list and
+ * drop everything known about its predecessor. Static objects never get read again afterwards,
+ * unless they get invalidated. */
+void insertObject(TickStateData &state, TickContext &context, const size_t index) {
+  auto &bodies = state.bodies;
+  const auto &object = *bodies.objects[index];
+  bodies.body_types[index] = object.getBodyType();
+  bodies.collision_layers[index] = object.getCollisionLayers();
+  bodies.collision_masks[index] = object.getCollisionMask();
+  bodies.velocities[index] = object.getVelocity();
+  bodies.is_sleeping[index] = 0;
+  bodies.contacts[index] = {};
+  updateBoundingBox(context, index);
+  bodies.positions[index] = bodies.bounding_boxes[index].min;
+  bodies.wake_up_positions[index] = bodies.positions[index];
+  if (!isStatic(bodies, index)) {
+    return;
+  }
+
+  /* Moving objects get their regions inserted by each tick building islands. */
+  if (bodies.is_collidable[index] != 0) {
+    state.island_broadphase.insert(index, bodies.bounding_boxes[index]);
+  } else {
+    state.island_broadphase.remove(index);
+  }
+}
+
+void applyTick(TickStateData &state, Integrator::Statistics &statistics,
+               const float substep_safety_factor) {
+  auto &bodies = state.bodies;
+  for (const auto index : state.moving_objects) {
+    bodies.is_sleeping[index] = bodies.objects[index]->isSleeping() ? 1 : 0;
+  }
+  measure(statistics.update_time, [&] { updateObjects(state); });
+
+  TickContext context{bodies,
+                      &state.broadphase,
+                      nullptr,
+                      nullptr,
+                      0,
+                      state.collision_candidates,
+                      state.static_geometries,
+                      state.shape_candidates,
+                      nullptr,
+                      statistics};
+  for (const auto index : state.moving_objects) {
+    const auto &object = *bodies.objects[index];
+    bodies.velocities[index] = object.getVelocity();
+    bodies.collision_layers[index] = object.getCollisionLayers();
+    bodies.collision_masks[index] = object.getCollisionMask();
+    updateBoundingBox(context, index);
+    bodies.substep_lengths[index] =
+        glm::max(object.getBoundingPolygon().computeSmallestExtent() * substep_safety_factor,
+                 substep_length_min);
+
+    bodies.positions[index] = bodies.bounding_boxes[index].min;
+  }
+  wakeUpObjectsNearMovingObjects(state);
+  measure(statistics.collision_time, [&] { moveAllObjects(state, context); });
+  count(statistics.ticks);
+
+  state.largest_motion = 0;
+  for (const auto index : state.moving_objects) {
+    if (bodies.is_collidable[index] != 0) {
+      const auto motion = bodies.bounding_boxes[index].min - bodies.positions[index];
+      state.largest_motion = glm::max(state.largest_motion, glm::length(motion));
+    }
   }
 }
 } // namespace
 
 namespace GameEngine::Physics {
+/** State reused between ticks. */
+struct Integrator::TickState : TickStateData {};
+
+Integrator::Integrator() : tick_state{std::make_unique<TickState>()} {}
+
+Integrator::~Integrator() = default;
+
+Integrator::Integrator(Integrator &&other) : Integrator{} { swap(other); }
+
+Integrator &Integrator::operator=(Integrator &&other) {
+  if (this != &other) {
+    Integrator fresh_integrator{};
+    swap(other);
+    other.swap(fresh_integrator);
+  }
+  return *this;
+}
+
 void Integrator::integrate(const std::chrono::microseconds duration_of_last_frame,
                            const std::vector<std::unique_ptr<Object>> &objects) {
+  auto &object_pointers = tick_state->object_pointers;
+  object_pointers.clear();
+  for (const auto &object : objects) {
+    object_pointers.push_back(object.get());
+  }
+  integrate(duration_of_last_frame, object_pointers);
+}
+
+void Integrator::integrate(const std::chrono::microseconds duration_of_last_frame,
+                           const std::vector<Object *> &objects) {
   const auto scaled_delta =
       std::chrono::duration_cast<std::chrono::microseconds>(duration_of_last_frame * speed_factor);
   auto unprocessed_time =
       std::min(scaled_delta + leftover_time_from_last_tick, integration_time_max);
 
+  /* Drop broadphase entries of objects which are no longer part of the object list. */
+  auto &state = *tick_state;
+  auto &bodies = state.bodies;
+  const auto previous_object_count = bodies.objects.size();
+  for (size_t index = objects.size(); index < bodies.objects.size(); ++index) {
+    state.broadphase.remove(index);
+    state.island_broadphase.remove(index);
+  }
+  bodies.objects.resize(objects.size());
+  bodies.velocities.resize(objects.size());
+  bodies.bounding_boxes.resize(objects.size());
+  bodies.is_collidable.resize(objects.size());
+  bodies.body_types.resize(objects.size());
+  bodies.collision_layers.resize(objects.size());
+  bodies.collision_masks.resize(objects.size());
+  bodies.is_sleeping.resize(objects.size());
+  bodies.positions.resize(objects.size());
+  bodies.wake_up_positions.resize(objects.size());
+  bodies.substep_lengths.resize(objects.size());
+  bodies.contacts.resize(objects.size());
+  state.unprocessed_objects.reserve(objects.size());
+  state.moving_objects.reserve(objects.size());
+  for (const auto index : state.invalidated_objects) {
+    if (index < objects.size()) {
+      bodies.objects[index] = nullptr;
+    }
+  }
+  state.invalidated_objects.clear();
+
+  /* Read objects which are new at their position or got invalidated. This also makes them visible
+   * to queryArea() before their first tick. Known objects only get their address compared. */
+  statistics = {};
+  TickContext context{bodies,
+                      &state.broadphase,
+                      nullptr,
+                      nullptr,
+                      0,
+                      state.collision_candidates,
+                      state.static_geometries,
+                      state.shape_candidates,
+                      nullptr,
+                      statistics};
+  auto has_changed = objects.size() != previous_object_count;
+  for (size_t index = 0; index < objects.size(); ++index) {
+    if (bodies.objects[index] != objects[index]) {
+      bodies.objects[index] = objects[index];
+      insertObject(state, context, index);
+      has_changed = true;
+    }
+  }
+  if (has_changed) {
+    state.static_geometries.clear();
+    state.moving_objects.clear();
+    for (size_t index = 0; index < objects.size(); ++index) {
+      if (objects[index]->getStaticGeometry() != nullptr) {
+        state.static_geometries.push_back(index);
+      }
+      if (!isStatic(bodies, index)) {
+        state.moving_objects.push_back(index);
+      }
+    }
+  }
+
   while (unprocessed_time >= tick_duration) {
-    applyTick(objects);
+    applyTick(state, statistics, substep_safety_factor);
+    tick_count++;
     unprocessed_time -= tick_duration;
   }
 
   leftover_time_from_last_tick = unprocessed_time;
 }
 
+void Integrator::invalidate(const size_t index) {
+  if (index < tick_state->bodies.objects.size()) {
+    tick_state->invalidated_objects.push_back(index);
+  }
+}
+
 float Integrator::getRendererInterpolationValue() const {
   return static_cast<float>(leftover_time_from_last_tick.count()) /
          std::chrono::duration_cast<std::chrono::microseconds>(tick_duration).count();
 }
 
+const Integrator::Statistics &Integrator::getStatistics() const { return statistics; }
+
+bool Integrator::isStatisticsEnabled() { return statistics_enabled; }
+
+uint64_t Integrator::getTickCount() const { return tick_count; }
+
+std::chrono::microseconds Integrator::getTickDuration() { return tick_duration; }
+
 float Integrator::getSpeedFactor() const { return speed_factor; }
 
 void Integrator::setSpeedFactor(const float speed_factor) {
   this->speed_factor = glm::max(speed_factor, 0.0f);
 }
+
+float Integrator::getSubstepSafetyFactor() const { return substep_safety_factor; }
+
+void Integrator::setSubstepSafetyFactor(const float safety_factor) {
+  substep_safety_factor = glm::clamp(safety_factor, 0.01f, 1.0f);
+}
+
+float Integrator::getBroadphaseCellSize() const { return tick_state->broadphase.getCellSize(); }
+
+void Integrator::setBroadphaseCellSize(const float cell_size) {
+  tick_state->broadphase = Geometry::SpatialHashGrid{cell_size};
+  tick_state->island_broadphase = Geometry::SpatialHashGrid{cell_size};
+
+  /* Insert all objects into the new grids during the next integrate() call. */
+  tick_state->bodies.objects.clear();
+  tick_state->static_geometries.clear();
+  tick_state->moving_objects.clear();
+}
+
+void Integrator::queryArea(const Geometry::BoundingBox &area, std::vector<size_t> &result) const {
+  const auto &bodies = tick_state->bodies;
+  tick_state->broadphase.query(area, result);
+  result.erase(std::remove_if(result.begin(), result.end(),
+                              [&](const size_t index) {
+                                return !Geometry::overlaps(area, bodies.bounding_boxes[index]);
+                              }),
+               result.end());
+
+  /* Static geometry is not part of the broadphase. */
+  for (const auto index : tick_state->static_geometries) {
+    if (Geometry::overlaps(area, bodies.objects[index]->getStaticGeometry()->getBoundingBox())) {
+      result.insert(std::upper_bound(result.begin(), result.end(), index), index);
+    }
+  }
+}
+
+float Integrator::getLargestMotion() const { return tick_state->largest_motion; }
+
+size_t Integrator::getWorkerCount() const {
+  return tick_state->thread_pool ? tick_state->thread_pool->getWorkerCount() : 0;
+}
+
+void Integrator::setWorkerCount(const size_t worker_count) {
+  tick_state->thread_pool.reset();
+  if (worker_count > 0) {
+    tick_state->thread_pool = std::make_unique<ThreadPool>(worker_count);
+  }
+}
+
+void Integrator::swap(Integrator &other) noexcept {
+  std::swap(leftover_time_from_last_tick, other.leftover_time_from_last_tick);
+  std::swap(tick_count, other.tick_count);
+  std::swap(statistics, other.statistics);
+  std::swap(speed_factor, other.speed_factor);
+  std::swap(substep_safety_factor, other.substep_safety_factor);
+  std::swap(tick_state, other.tick_state);
+}
 } // namespace GameEngine::Physics
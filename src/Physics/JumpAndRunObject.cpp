@@ -7,13 +7,16 @@
 #include <glm/gtx/projection.hpp>
 #include <glm/gtx/rotate_vector.hpp>
 
+namespace {
+/** Amount of ticks for which calls to jump() get buffered, 100 ms at 60 ticks per second. */
+constexpr uint16_t jump_buffer_ticks = 6;
+} // namespace
+
 namespace GameEngine::Physics {
 JumpAndRunObject::JumpAndRunObject(std::initializer_list<glm::vec2> vertices)
     : DynamicObject{vertices} {}
 
 void JumpAndRunObject::update() {
-  using namespace std::chrono_literals;
-
   /* Capture base classes values before calling its update() function. */
   const bool standing_on_ground = isTouchingGround();
   const auto direction_to_colliding_wall = isTouchingWall();
@@ -41,28 +44,35 @@ void JumpAndRunObject::update() {
     }
   }
 
-  if (std::chrono::steady_clock::now() - time_of_jump_request < 100ms) {
+  if (jump_request_ticks_remaining > 0) {
+    jump_request_ticks_remaining--;
     if (standing_on_ground) {
-      time_of_jump_request = {};
+      jump_request_ticks_remaining = 0;
       setVelocity({getVelocity().x, jump_power * (1 - getGroundStickiness())});
     } else if (walljump_enabled && direction_to_colliding_wall.has_value()) {
-      time_of_jump_request = {};
+      jump_request_ticks_remaining = 0;
       const auto inversion_factor = direction_to_colliding_wall->x < 0 ? -1 : 1;
       const glm::vec2 jump_direction = {
           glm::rotate(glm::vec2{0, 1}, glm::radians(45.0f)).x * inversion_factor, 1};
       setVelocity(jump_direction * jump_power * (1 - getWallStickiness()));
     } else if (airjumps_remaining > 0) {
-      time_of_jump_request = {};
+      jump_request_ticks_remaining = 0;
       airjumps_remaining--;
       setVelocity({getVelocity().x, jump_power});
     }
   }
 }
 
-void JumpAndRunObject::jump() { time_of_jump_request = std::chrono::steady_clock::now(); }
+void JumpAndRunObject::jump() {
+  jump_request_ticks_remaining = jump_buffer_ticks;
+  wakeUp();
+}
 
 void JumpAndRunObject::run(const std::optional<HorizontalDirection> direction) {
   acceleration_direction = direction;
+  if (direction.has_value()) {
+    wakeUp();
+  }
 }
 
 float JumpAndRunObject::getJumpPower() const { return jump_power; }
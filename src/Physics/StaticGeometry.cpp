@@ -0,0 +1,325 @@
+/** @file
+ * Implements baked, immutable world geometry.
+ */
+
+#include "GameEngine/Physics/StaticGeometry.hpp"
+#include "GameEngine/Camera.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <glm/common.hpp>
+#include <glm/geometric.hpp>
+#include <iterator>
+#include <optional>
+#include <tuple>
+
+using namespace GameEngine;
+
+namespace {
+/** Tolerance for considering line segments as lying on the same line and touching each other. Also
+ * the sine of the largest angle between edges which count as lying on the same line. */
+constexpr float merge_distance_max = 0.0001;
+
+/** Polygons merged into larger polygons stay within the inline storage of Geometry::VertexList. */
+constexpr size_t merged_vertex_count_max = 8;
+
+float cross(const glm::vec2 a, const glm::vec2 b) { return a.x * b.y - a.y * b.x; }
+
+/** @return The given value in multiples of merge_distance_max. Values on the same line map to the
+ * same integer, unless they happen to lie close to the boundary between two integers. */
+int64_t quantize(const float value) {
+  return std::llround(static_cast<double>(value) / merge_distance_max);
+}
+
+/** Line segment sorted by the line it lies on and by its position along that line. */
+struct SegmentEntry {
+  /** Quantized direction and distance to the origin of the line. Equal for segments on the same
+   * line, regardless of their direction. */
+  int64_t direction_x;
+  int64_t direction_y;
+  int64_t offset;
+
+  /** Smallest and largest position of its endpoints along the line. */
+  float start;
+  float end;
+
+  /** Position of the segment in the list of shapes. */
+  size_t index;
+
+  bool liesOnSameLine(const SegmentEntry &other) const {
+    return direction_x == other.direction_x && direction_y == other.direction_y &&
+           offset == other.offset;
+  }
+
+  bool operator<(const SegmentEntry &other) const {
+    return std::tie(direction_x, direction_y, offset, start, index) <
+           std::tie(other.direction_x, other.direction_y, other.offset, other.start, other.index);
+  }
+};
+
+/** Remove all shapes flagged in the given list, keeping the order of the others. */
+void removeFlaggedShapes(std::vector<Geometry::VertexList> &shapes,
+                         const std::vector<uint8_t> &is_removed) {
+  size_t kept_count = 0;
+  for (size_t index = 0; index < shapes.size(); ++index) {
+    if (is_removed[index] == 0) {
+      shapes[kept_count] = std::move(shapes[index]);
+      ++kept_count;
+    }
+  }
+  shapes.resize(kept_count);
+}
+
+/** Merge line segments which lie on the same line and touch or overlap each other. Sorts the
+ * segments by their line and their position along it, which allows merging them in a single pass.
+ * Merged segments take the place of their first segment in the given list and keep its
+ * direction. */
+void mergeCollinearSegments(std::vector<Geometry::VertexList> &shapes) {
+  std::vector<SegmentEntry> segments;
+  for (size_t index = 0; index < shapes.size(); ++index) {
+    const auto &shape = shapes[index];
+    const auto length = shape.size() == 2 ? glm::distance(shape.front(), shape.back()) : 0.0f;
+    if (length <= merge_distance_max) {
+      continue;
+    }
+    auto direction = (shape.back() - shape.front()) / length;
+    auto direction_x = quantize(direction.x);
+    auto direction_y = quantize(direction.y);
+    if (direction_x < 0 || (direction_x == 0 && direction_y < 0)) {
+      direction = -direction;
+      direction_x = -direction_x;
+      direction_y = -direction_y;
+    }
+    const auto start = glm::dot(shape.front(), direction);
+    const auto end = glm::dot(shape.back(), direction);
+    segments.push_back({direction_x, direction_y, quantize(cross(direction, shape.front())),
+                        glm::min(start, end), glm::max(start, end), index});
+  }
+  std::sort(segments.begin(), segments.end());
+
+  std::vector<uint8_t> is_removed(shapes.size(), 0);
+  size_t first = 0;
+  while (first < segments.size()) {
+    /* Find all following segments on the same line which touch the segments before them. */
+    auto last = first + 1;
+    auto end = segments[first].end;
+    auto target = segments[first].index;
+    while (last < segments.size() && segments[last].liesOnSameLine(segments[first]) &&
+           segments[last].start <= end + merge_distance_max) {
+      end = glm::max(end, segments[last].end);
+      target = std::min(target, segments[last].index);
+      ++last;
+    }
+
+    if (last - first > 1) {
+      /* Positions of all endpoints along the target segment, which spans [0, length]. */
+      const auto origin = shapes[target].front();
+      const auto length = glm::distance(origin, shapes[target].back());
+      const auto direction = (shapes[target].back() - origin) / length;
+      float merged_start = 0;
+      float merged_end = length;
+      for (auto position = first; position < last; ++position) {
+        const auto index = segments[position].index;
+        for (const auto vertex : shapes[index]) {
+          const auto distance = glm::dot(vertex - origin, direction);
+          merged_start = glm::min(merged_start, distance);
+          merged_end = glm::max(merged_end, distance);
+        }
+        is_removed[index] = index == target ? 0 : 1;
+      }
+      shapes[target] = {origin + direction * merged_start, origin + direction * merged_end};
+    }
+    first = last;
+  }
+  removeFlaggedShapes(shapes, is_removed);
+}
+
+/** @return The given polygon with its vertices in counter-clockwise order. */
+Geometry::VertexList toCounterClockwise(const Geometry::VertexList &polygon) {
+  float double_area = 0;
+  for (size_t index = 0; index < polygon.size(); ++index) {
+    double_area += cross(polygon[index], polygon[(index + 1) % polygon.size()]);
+  }
+  if (double_area >= 0) {
+    return polygon;
+  }
+  return {std::make_reverse_iterator(polygon.end()), std::make_reverse_iterator(polygon.begin())};
+}
+
+/** @return Polygon merged from two counter-clockwise polygons sharing the given edge, without
+ * vertices lying on the line between their neighbours. Nothing if it would not be convex or would
+ * have too many vertices.
+ *
+ * @param a_edge Position of the edge in a, which leads from a[a_edge] to a[a_edge + 1].
+ * @param b_edge Position of the same edge in b, which leads in the opposite direction.
+ */
+std::optional<Geometry::VertexList> mergePolygons(const Geometry::VertexList &a,
+                                                  const size_t a_edge,
+                                                  const Geometry::VertexList &b,
+                                                  const size_t b_edge) {
+  Geometry::VertexList merged;
+  for (size_t offset = 1; offset <= a.size(); ++offset) {
+    merged.push_back(a[(a_edge + offset) % a.size()]);
+  }
+  for (size_t offset = 2; offset < b.size(); ++offset) {
+    merged.push_back(b[(b_edge + offset) % b.size()]);
+  }
+
+  Geometry::VertexList result;
+  for (size_t index = 0; index < merged.size(); ++index) {
+    const auto previous = merged[(index + merged.size() - 1) % merged.size()];
+    const auto vertex = merged[index];
+    const auto next = merged[(index + 1) % merged.size()];
+    const auto incoming = vertex - previous;
+    const auto outgoing = next - vertex;
+    const auto turn = cross(incoming, outgoing);
+    if (turn > merge_distance_max * glm::length(incoming) * glm::length(outgoing)) {
+      result.push_back(vertex);
+    } else if (turn < 0 || glm::dot(incoming, outgoing) <= 0) {
+      /* Reflex vertex or the polygon folds back onto itself. */
+      return std::nullopt;
+    }
+  }
+  if (result.size() < 3 || result.size() > merged_vertex_count_max) {
+    return std::nullopt;
+  }
+  return result;
+}
+
+/** Edge of a counter-clockwise polygon. */
+struct EdgeEntry {
+  glm::vec2 from;
+  glm::vec2 to;
+  size_t shape_index;
+  size_t position; /**< Position of the edge in its polygon. */
+
+  /** Key for finding the same edge in the opposite direction. */
+  std::tuple<float, float, float, float> getKey() const { return {from.x, from.y, to.x, to.y}; }
+};
+
+/** Merge neighbouring polygons which share a whole edge, as long as the result stays convex. E.g.
+ * turns rows of tiles into a single polygon, which removes the edges between the tiles that moving
+ * objects could get caught on. Each polygon gets merged at most once per pass over all edges, and
+ * passes get repeated until nothing merges anymore. Merged polygons take the place of their first
+ * polygon in the given list. */
+void mergeAdjacentPolygons(std::vector<Geometry::VertexList> &shapes) {
+  std::vector<EdgeEntry> edges;
+  std::vector<uint8_t> is_merged;
+  std::vector<uint8_t> is_removed;
+  bool merged_any = true;
+  while (merged_any) {
+    merged_any = false;
+    edges.clear();
+    for (size_t index = 0; index < shapes.size(); ++index) {
+      if (shapes[index].size() < 3) {
+        continue;
+      }
+      const auto polygon = toCounterClockwise(shapes[index]);
+      for (size_t position = 0; position < polygon.size(); ++position) {
+        edges.push_back(
+            {polygon[position], polygon[(position + 1) % polygon.size()], index, position});
+      }
+    }
+    const auto by_key = [](const EdgeEntry &a, const EdgeEntry &b) {
+      return std::tie(a.from.x, a.from.y, a.to.x, a.to.y, a.shape_index) <
+             std::tie(b.from.x, b.from.y, b.to.x, b.to.y, b.shape_index);
+    };
+    std::sort(edges.begin(), edges.end(), by_key);
+
+    is_merged.assign(shapes.size(), 0);
+    is_removed.assign(shapes.size(), 0);
+    for (size_t index = 0; index < shapes.size(); ++index) {
+      if (shapes[index].size() < 3 || is_merged[index] != 0) {
+        continue;
+      }
+      const auto polygon = toCounterClockwise(shapes[index]);
+      for (size_t position = 0; position < polygon.size() && is_merged[index] == 0; ++position) {
+        const EdgeEntry reverse_edge{polygon[(position + 1) % polygon.size()], polygon[position],
+                                     0, 0};
+        for (auto other = std::lower_bound(edges.cbegin(), edges.cend(), reverse_edge, by_key);
+             other != edges.cend() && other->getKey() == reverse_edge.getKey(); ++other) {
+          if (other->shape_index == index || is_merged[other->shape_index] != 0) {
+            continue;
+          }
+          const auto merged = mergePolygons(
+              polygon, position, toCounterClockwise(shapes[other->shape_index]), other->position);
+          if (merged) {
+            shapes[std::min(index, other->shape_index)] = *merged;
+            is_removed[std::max(index, other->shape_index)] = 1;
+            is_merged[index] = 1;
+            is_merged[other->shape_index] = 1;
+            merged_any = true;
+            break;
+          }
+        }
+      }
+    }
+    removeFlaggedShapes(shapes, is_removed);
+  }
+}
+} // namespace
+
+namespace GameEngine::Physics {
+StaticGeometry::StaticGeometry(const std::vector<Geometry::VertexList> &shapes) {
+  std::vector<Geometry::VertexList> baked_shapes;
+  for (const auto &shape : shapes) {
+    if (!shape.empty()) {
+      baked_shapes.push_back(shape);
+    }
+  }
+  mergeCollinearSegments(baked_shapes);
+  mergeAdjacentPolygons(baked_shapes);
+
+  this->shapes.reserve(baked_shapes.size());
+  std::vector<Geometry::BoundingBox> bounding_boxes;
+  bounding_boxes.reserve(baked_shapes.size());
+  for (const auto &shape : baked_shapes) {
+    const auto &polygon = this->shapes.emplace_back(shape);
+    bounding_boxes.push_back(polygon.getBoundingBox());
+    bounding_box =
+        this->shapes.size() == 1
+            ? polygon.getBoundingBox()
+            : Geometry::BoundingBox{glm::min(bounding_box.min, polygon.getBoundingBox().min),
+                                    glm::max(bounding_box.max, polygon.getBoundingBox().max)};
+  }
+  shape_index.build(bounding_boxes);
+}
+
+const std::vector<ConvexBoundingPolygon> &StaticGeometry::getShapes() const { return shapes; }
+
+const Geometry::BoundingBox &StaticGeometry::getBoundingBox() const { return bounding_box; }
+
+void StaticGeometry::queryArea(const Geometry::BoundingBox &area,
+                               std::vector<size_t> &result) const {
+  shape_index.queryArea(area, result);
+}
+
+std::optional<Geometry::BVH::RaycastHit> StaticGeometry::raycast(const glm::vec2 start,
+                                                                 const glm::vec2 end) const {
+  return shape_index.raycast(start, end, [&](const size_t index) {
+    return Geometry::intersectSegment(start, end, shapes[index].getVertices());
+  });
+}
+
+void StaticGeometry::update() {}
+
+glm::vec2 StaticGeometry::getVelocity() const { return {0, 0}; }
+
+void StaticGeometry::addVelocityOffset(glm::vec2) {}
+
+const ConvexBoundingPolygon &StaticGeometry::getBoundingPolygon() const { return empty_polygon; }
+
+void StaticGeometry::handleCollisionWith(Object &, glm::vec2) {}
+
+BodyType StaticGeometry::getBodyType() const { return BodyType::Static; }
+
+const StaticGeometry *StaticGeometry::getStaticGeometry() const { return this; }
+
+void StaticGeometry::render(LineBatch &line_batch, const Camera &camera, float) const {
+  queryArea(camera.getVisibleArea(), visible_shapes);
+  line_batch.setColor({180, 180, 255, 255});
+  for (const auto index : visible_shapes) {
+    line_batch.addPolygon(camera.toScreenCoordinates(shapes[index].getVertices()));
+  }
+}
+} // namespace GameEngine::Physics
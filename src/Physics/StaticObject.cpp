@@ -19,13 +19,22 @@ const ConvexBoundingPolygon &StaticObject::getBoundingPolygon() const { return b
 
 void StaticObject::handleCollisionWith(Physics::Object &, glm::vec2) {}
 
-void StaticObject::render(SDL_Renderer *renderer, const Camera &camera, float) const {
-  SDL_SetRenderDrawColor(renderer, 180, 180, 255, 255);
-  Geometry::forEachEdge(bounding_polygon.getVertices(),
-                        [&](const glm::vec2 world_start, const glm::vec2 world_end) {
-                          const auto start = camera.toScreenCoordinate(world_start);
-                          const auto end = camera.toScreenCoordinate(world_end);
-                          SDL_RenderDrawLine(renderer, start.x, start.y, end.x, end.y);
-                        });
+BodyType StaticObject::getBodyType() const { return BodyType::Static; }
+
+uint32_t StaticObject::getCollisionLayers() const { return collision_layers; }
+
+void StaticObject::setCollisionLayers(const uint32_t collision_layers) {
+  this->collision_layers = collision_layers;
+}
+
+uint32_t StaticObject::getCollisionMask() const { return collision_mask; }
+
+void StaticObject::setCollisionMask(const uint32_t collision_mask) {
+  this->collision_mask = collision_mask;
+}
+
+void StaticObject::render(LineBatch &line_batch, const Camera &camera, float) const {
+  line_batch.setColor({180, 180, 255, 255});
+  line_batch.addPolygon(camera.toScreenCoordinates(bounding_polygon.getVertices()));
 }
 } // namespace GameEngine::Physics
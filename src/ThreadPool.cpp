@@ -0,0 +1,92 @@
+/** @file
+ * Implements a pool of worker threads.
+ */
+
+#include "GameEngine/ThreadPool.hpp"
+#include <utility>
+
+namespace GameEngine {
+ThreadPool::ThreadPool(const size_t worker_count) {
+  workers.reserve(worker_count);
+  for (size_t index = 0; index < worker_count; ++index) {
+    workers.emplace_back([this] { runWorker(); });
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard lock{mutex};
+    shutting_down = true;
+  }
+  work_available.notify_all();
+  for (auto &worker : workers) {
+    worker.join();
+  }
+}
+
+size_t ThreadPool::getWorkerCount() const { return workers.size(); }
+
+void ThreadPool::forEach(const size_t task_count,
+                         const std::function<void(size_t task_index)> &function) {
+  if (task_count == 0) {
+    return;
+  }
+
+  {
+    std::lock_guard lock{mutex};
+    current_function = &function;
+    this->task_count = task_count;
+    next_task_index = 0;
+    first_exception = nullptr;
+    busy_workers = workers.size();
+    ++generation;
+  }
+  work_available.notify_all();
+
+  processTasks();
+
+  std::unique_lock lock{mutex};
+  work_done.wait(lock, [this] { return busy_workers == 0; });
+  current_function = nullptr;
+  if (first_exception) {
+    std::rethrow_exception(std::exchange(first_exception, nullptr));
+  }
+}
+
+void ThreadPool::processTasks() {
+  for (size_t task_index = next_task_index++; task_index < task_count;
+       task_index = next_task_index++) {
+    try {
+      (*current_function)(task_index);
+    } catch (...) {
+      std::lock_guard lock{mutex};
+      if (!first_exception) {
+        first_exception = std::current_exception();
+      }
+    }
+  }
+}
+
+void ThreadPool::runWorker() {
+  uint64_t processed_generation = 0;
+  while (true) {
+    {
+      std::unique_lock lock{mutex};
+      work_available.wait(lock,
+                          [&] { return shutting_down || generation != processed_generation; });
+      if (shutting_down) {
+        return;
+      }
+      processed_generation = generation;
+    }
+
+    processTasks();
+
+    {
+      std::lock_guard lock{mutex};
+      --busy_workers;
+    }
+    work_done.notify_one();
+  }
+}
+} // namespace GameEngine
@@ -0,0 +1,118 @@
+/** @file
+ * Tests the camera.
+ */
+
+#include <GameEngine/Camera.hpp>
+#include <doctest/doctest.h>
+#include <cmath>
+#include <glm/gtc/constants.hpp>
+
+using namespace GameEngine;
+
+TEST_CASE("Camera converts between world and screen coordinates") {
+  Camera camera{200, 100};
+  camera.setPosition({5, 3});
+  camera.setZoom(2);
+  camera.setOrientation(0.3);
+
+  const glm::vec2 world_coordinate{7.5, -1.25};
+  const auto result = camera.toWorldCoordinate(camera.toScreenCoordinate(world_coordinate));
+  REQUIRE(result.x == doctest::Approx(world_coordinate.x));
+  REQUIRE(result.y == doctest::Approx(world_coordinate.y));
+}
+
+TEST_CASE("Camera visible area") {
+  /* The shorter screen side spans 27 units in the game world. */
+  Camera camera{200, 100};
+  camera.setPosition({10, -5});
+
+  SUBCASE("Default") {
+    const auto area = camera.getVisibleArea();
+    REQUIRE(area.min.x == doctest::Approx(10 - 27));
+    REQUIRE(area.max.x == doctest::Approx(10 + 27));
+    REQUIRE(area.min.y == doctest::Approx(-5 - 13.5));
+    REQUIRE(area.max.y == doctest::Approx(-5 + 13.5));
+  }
+
+  SUBCASE("Zoomed in") {
+    camera.setZoom(2);
+    const auto area = camera.getVisibleArea();
+    REQUIRE(area.min.x == doctest::Approx(10 - 13.5));
+    REQUIRE(area.max.x == doctest::Approx(10 + 13.5));
+    REQUIRE(area.min.y == doctest::Approx(-5 - 6.75));
+    REQUIRE(area.max.y == doctest::Approx(-5 + 6.75));
+  }
+
+  SUBCASE("Zoomed out completely") {
+    camera.setZoom(-1);
+    const auto area = camera.getVisibleArea();
+    REQUIRE(std::isfinite(area.min.x));
+    REQUIRE(std::isfinite(area.min.y));
+    REQUIRE(area.max.x > area.min.x);
+    REQUIRE(area.max.y > area.min.y);
+  }
+
+  SUBCASE("Rotated by 90 degrees") {
+    camera.setOrientation(glm::half_pi<float>());
+    const auto area = camera.getVisibleArea();
+    REQUIRE(area.min.x == doctest::Approx(10 - 13.5));
+    REQUIRE(area.max.x == doctest::Approx(10 + 13.5));
+    REQUIRE(area.min.y == doctest::Approx(-5 - 27));
+    REQUIRE(area.max.y == doctest::Approx(-5 + 27));
+  }
+
+  SUBCASE("Rotated by 45 degrees contains all corners") {
+    camera.setOrientation(glm::pi<float>() / 4);
+    const auto area = camera.getVisibleArea();
+    const auto half_diagonal = glm::sqrt(27.0f * 27.0f + 13.5f * 13.5f);
+    REQUIRE(area.max.x - area.min.x <= 2 * half_diagonal + 0.01);
+    REQUIRE(area.max.x - area.min.x == doctest::Approx(area.max.y - area.min.y));
+    REQUIRE(area.min.x == doctest::Approx(10 - (27 + 13.5) / glm::sqrt(2.0f)));
+  }
+}
+
+TEST_CASE("Camera converts multiple vertices at once") {
+  Camera camera{1280, 800};
+  camera.setPosition({-3, 12});
+  camera.setZoom(0.75);
+  camera.setOrientation(2.5);
+
+  const Geometry::VertexList world_coordinates{{0, 0}, {1, 2}, {-4.5, 3}, {10, -7}, {0.25, 0.5}};
+  const auto result = camera.toScreenCoordinates(world_coordinates);
+  REQUIRE(result.size() == world_coordinates.size());
+  for (size_t index = 0; index < world_coordinates.size(); ++index) {
+    const auto expected = camera.toScreenCoordinate(world_coordinates[index]);
+    REQUIRE(result[index].x == doctest::Approx(expected.x));
+    REQUIRE(result[index].y == doctest::Approx(expected.y));
+  }
+
+  SUBCASE("In place") {
+    auto vertices = world_coordinates;
+    camera.toScreenCoordinates(vertices.data(), vertices.size(), vertices.data());
+    for (size_t index = 0; index < vertices.size(); ++index) {
+      REQUIRE(vertices[index].x == doctest::Approx(result[index].x));
+      REQUIRE(vertices[index].y == doctest::Approx(result[index].y));
+    }
+  }
+}
+
+TEST_CASE("Camera transformation follows position, zoom and orientation") {
+  Camera camera{200, 100};
+  camera.setPosition({4, 2});
+
+  /* 100 pixels span 27 units, the y axis points down on screen. */
+  auto result = camera.toScreenCoordinate({5, 3});
+  REQUIRE(result.x == doctest::Approx(100 + 100 / 27.0f));
+  REQUIRE(result.y == doctest::Approx(50 - 100 / 27.0f));
+
+  camera.setZoom(2);
+  camera.setOrientation(glm::half_pi<float>());
+  result = camera.toScreenCoordinate({5, 2});
+  REQUIRE(result.x == doctest::Approx(100));
+  REQUIRE(result.y == doctest::Approx(50 + 200 / 27.0f));
+
+  camera.stepTowardsPosition({14, 2});
+  result = camera.toScreenCoordinate({5, 2});
+  REQUIRE(result.x == doctest::Approx(100));
+  REQUIRE(result.y == doctest::Approx(50));
+}
@@ -3,10 +3,12 @@
  */
 
 #include <GameEngine/ConvexBoundingPolygon.hpp>
+#include <cstring>
 #include <doctest/doctest.h>
 #include <glm/geometric.hpp>
 #include <glm/gtc/constants.hpp>
 #include <glm/trigonometric.hpp>
+#include <random>
 
 using namespace GameEngine;
 
@@ -35,6 +37,16 @@ TEST_CASE("Compute center of polygons") {
   }
 }
 
+TEST_CASE("Construct polygon from vertex list") {
+  const Geometry::VertexList vertices{{-1, 1}, {-1, -1}, {1, -1}, {1, 1}};
+  const ConvexBoundingPolygon polygon{vertices};
+  REQUIRE(polygon.getVertices().size() == quad.getVertices().size());
+  for (size_t index = 0; index < vertices.size(); ++index) {
+    REQUIRE(polygon.getVertices()[index] == quad.getVertices()[index]);
+  }
+  REQUIRE(polygon.getPosition() == quad.getPosition());
+}
+
 TEST_CASE("Update position of polygon") {
   SUBCASE("Polygon with two vertices") {
     ConvexBoundingPolygon line{{-1, 1}, {1, -1}};
@@ -84,6 +96,52 @@ TEST_CASE("Rotate polygon") {
   REQUIRE(rotated_quad.getVertices().at(3).y == doctest::Approx(glm::root_two<float>()));
 }
 
+TEST_CASE("Bounding box of polygon") {
+  SUBCASE("Polygon with zero vertices") {
+    const auto &bounding_box = ConvexBoundingPolygon{}.getBoundingBox();
+    REQUIRE(bounding_box.min.x == doctest::Approx(0));
+    REQUIRE(bounding_box.min.y == doctest::Approx(0));
+    REQUIRE(bounding_box.max.x == doctest::Approx(0));
+    REQUIRE(bounding_box.max.y == doctest::Approx(0));
+  }
+
+  SUBCASE("Polygon with three vertices") {
+    const ConvexBoundingPolygon triangle{{1.6, 0.25}, {2.1, -0.6}, {0.3, -1.3}};
+    REQUIRE(triangle.getBoundingBox().min.x == doctest::Approx(0.3));
+    REQUIRE(triangle.getBoundingBox().min.y == doctest::Approx(-1.3));
+    REQUIRE(triangle.getBoundingBox().max.x == doctest::Approx(2.1));
+    REQUIRE(triangle.getBoundingBox().max.y == doctest::Approx(0.25));
+  }
+
+  SUBCASE("Moved polygon") {
+    ConvexBoundingPolygon moved_quad = quad;
+    moved_quad.setPosition({10, 20});
+    REQUIRE(moved_quad.getBoundingBox().min.x == doctest::Approx(9));
+    REQUIRE(moved_quad.getBoundingBox().min.y == doctest::Approx(19));
+    REQUIRE(moved_quad.getBoundingBox().max.x == doctest::Approx(11));
+    REQUIRE(moved_quad.getBoundingBox().max.y == doctest::Approx(21));
+  }
+
+  SUBCASE("Rotated polygon") {
+    ConvexBoundingPolygon rotated_quad = quad;
+    rotated_quad.setOrientation(glm::radians(45.0f));
+    REQUIRE(rotated_quad.getBoundingBox().min.x == doctest::Approx(-glm::root_two<float>()));
+    REQUIRE(rotated_quad.getBoundingBox().min.y == doctest::Approx(-glm::root_two<float>()));
+    REQUIRE(rotated_quad.getBoundingBox().max.x == doctest::Approx(glm::root_two<float>()));
+    REQUIRE(rotated_quad.getBoundingBox().max.y == doctest::Approx(glm::root_two<float>()));
+  }
+}
+
+TEST_CASE("Polygons with disjoint bounding boxes don't collide") {
+  const ConvexBoundingPolygon far_away_quad{{9, 11}, {9, 9}, {11, 9}, {11, 11}};
+  REQUIRE_FALSE(quad.collidesWith(far_away_quad));
+  REQUIRE_FALSE(far_away_quad.collidesWith(quad));
+
+  const ConvexBoundingPolygon touching_quad{{1, 1}, {1, -1}, {3, -1}, {3, 1}};
+  REQUIRE_FALSE(quad.collidesWith(touching_quad));
+  REQUIRE_FALSE(touching_quad.collidesWith(quad));
+}
+
 TEST_CASE("Polygon collision with zero vertices") {
   const ConvexBoundingPolygon empty_polygon{};
   REQUIRE_FALSE(empty_polygon.collidesWith(quad));
@@ -184,6 +242,23 @@ TEST_CASE("Polygon collision resolving is independent of edge orientation") {
   }
 }
 
+TEST_CASE("Polygon collision considers orientation") {
+  ConvexBoundingPolygon rotated_quad = quad;
+  const ConvexBoundingPolygon point_inside_quad{{0.9, 0.8}};
+  const ConvexBoundingPolygon point_inside_rotated_quad{{1.2, 0.1}};
+  REQUIRE(point_inside_quad.collidesWith(rotated_quad));
+  REQUIRE_FALSE(point_inside_rotated_quad.collidesWith(rotated_quad));
+
+  rotated_quad.setOrientation(glm::radians(45.0f));
+  REQUIRE_FALSE(point_inside_quad.collidesWith(rotated_quad));
+  REQUIRE_FALSE(rotated_quad.collidesWith(point_inside_quad));
+
+  const auto displacement = point_inside_rotated_quad.collidesWith(rotated_quad);
+  REQUIRE(displacement);
+  REQUIRE(displacement->x == doctest::Approx(0.0571).epsilon(0.001));
+  REQUIRE(displacement->y == doctest::Approx(0.0571).epsilon(0.001));
+}
+
 TEST_CASE("Polygon collides with itself") { REQUIRE(quad.collidesWith(quad)); }
 
 TEST_CASE("Nested Polygon collision") {
@@ -207,3 +282,150 @@ TEST_CASE("Collision with infinitesimally small displacement vector") {
   REQUIRE_FALSE(line1.collidesWith(line2));
   REQUIRE_FALSE(line2.collidesWith(line1));
 }
+
+TEST_CASE("SIMD projection produces bit-identical results to scalar projection") {
+  std::mt19937 generator{1337};
+  std::uniform_real_distribution<float> coordinate{-100, 100};
+  std::uniform_real_distribution<float> angle{0, glm::two_pi<float>()};
+
+  for (size_t vertex_count = 1; vertex_count <= 16; ++vertex_count) {
+    for (size_t axis_count = 1; axis_count <= 9; ++axis_count) {
+      Geometry::VertexList polygon;
+      for (size_t index = 0; index < vertex_count; ++index) {
+        polygon.push_back({coordinate(generator), coordinate(generator)});
+      }
+      Geometry::VertexList axes;
+      for (size_t index = 0; index < axis_count; ++index) {
+        const auto axis_angle = angle(generator);
+        axes.push_back({glm::cos(axis_angle), glm::sin(axis_angle)});
+      }
+
+      const auto projections = Geometry::projectOntoAxes(polygon, axes);
+      const auto scalar_projections = Geometry::projectOntoAxesScalar(polygon, axes);
+      REQUIRE(projections.size() == axis_count);
+      REQUIRE(scalar_projections.size() == axis_count);
+      REQUIRE(std::memcmp(projections.data(), scalar_projections.data(),
+                          sizeof(Geometry::Projection) * axis_count) == 0);
+    }
+  }
+}
+
+TEST_CASE("Collision check with separating axis hint") {
+  /* Bounding boxes overlap, but the triangle lies beyond the upper right corner of the quad. */
+  const ConvexBoundingPolygon triangle{{0.5, 2}, {2, 0.5}, {2, 2}};
+  ConvexBoundingPolygon::SeparatingAxisHint hint{};
+
+  SUBCASE("Remembers the separating axis") {
+    REQUIRE_FALSE(quad.collidesWith(triangle, hint));
+    REQUIRE(hint.axis_index >= 0);
+    REQUIRE_FALSE(quad.collidesWith(triangle, hint));
+  }
+
+  SUBCASE("Forgets the separating axis on collision") {
+    hint.axis_index = 1;
+    REQUIRE(quad.collidesWith(quad, hint));
+    REQUIRE(hint.axis_index == -1);
+  }
+
+  SUBCASE("Ignores hints which are out of range") {
+    hint.axis_index = 100;
+    REQUIRE(quad.collidesWith(quad, hint));
+  }
+}
+
+TEST_CASE("Collision check with separating axis hint produces identical results") {
+  std::mt19937 generator{1337};
+  std::uniform_real_distribution<float> position{-1.5, 1.5};
+  std::uniform_real_distribution<float> angle{0, glm::two_pi<float>()};
+
+  ConvexBoundingPolygon a{{-0.5, 0.5}, {-0.5, -0.5}, {0.5, -0.5}, {0.5, 0.5}};
+  ConvexBoundingPolygon b{{0, 0}, {1, 0.25}, {0.75, 1}};
+  ConvexBoundingPolygon::SeparatingAxisHint hint{};
+  for (size_t iteration = 0; iteration < 1000; ++iteration) {
+    /* Move b slightly each iteration, like a moving object in consecutive substeps. */
+    b.setPosition(b.getPosition() * 0.9f + glm::vec2{position(generator), position(generator)} *
+                                               0.1f);
+    if (iteration % 7 == 0) {
+      a.setOrientation(angle(generator));
+    }
+
+    const auto expected = a.collidesWith(b);
+    const auto result = a.collidesWith(b, hint);
+    REQUIRE(result.has_value() == expected.has_value());
+    if (expected) {
+      REQUIRE(result->x == expected->x);
+      REQUIRE(result->y == expected->y);
+    }
+  }
+}
+
+TEST_CASE("Time of impact between moving polygons") {
+  const ConvexBoundingPolygon quad{{-0.5, 0.5}, {-0.5, -0.5}, {0.5, -0.5}, {0.5, 0.5}};
+
+  SUBCASE("Head-on") {
+    const ConvexBoundingPolygon wall{{2, -5}, {2, 5}, {3, 5}, {3, -5}};
+    REQUIRE(*quad.computeTimeOfImpact(wall, {3, 0}) == doctest::Approx(0.5));
+    REQUIRE(*quad.computeTimeOfImpact(wall, {3, 0}, 0.3) == doctest::Approx(0.6));
+    REQUIRE_FALSE(quad.computeTimeOfImpact(wall, {1, 0}));
+    REQUIRE_FALSE(quad.computeTimeOfImpact(wall, {-3, 0}));
+  }
+
+  SUBCASE("Passing through a thin line") {
+    const ConvexBoundingPolygon line{{0, -3}, {0.5, -3}};
+    REQUIRE(*quad.computeTimeOfImpact(line, {0, -100}) == doctest::Approx(0.025));
+  }
+
+  SUBCASE("Passing by diagonally") {
+    const ConvexBoundingPolygon triangle{{2, 0}, {4, 0}, {4, 2}};
+    REQUIRE_FALSE(quad.computeTimeOfImpact(triangle, {0, 3}));
+    REQUIRE(*quad.computeTimeOfImpact(triangle, {4, 0.5}) == doctest::Approx(0.375));
+  }
+
+  SUBCASE("Already overlapping") {
+    const ConvexBoundingPolygon other{{0, 0}, {1, 0}, {1, 1}};
+    REQUIRE(*quad.computeTimeOfImpact(other, {5, 5}) == doctest::Approx(0));
+    REQUIRE(*quad.computeTimeOfImpact(other, {0, 0}) == doctest::Approx(0));
+  }
+
+  SUBCASE("Sliding along a touching polygon") {
+    const ConvexBoundingPolygon floor{{-5, -0.5}, {5, -0.5}, {5, -1}, {-5, -1}};
+    REQUIRE_FALSE(quad.computeTimeOfImpact(floor, {2, 0}));
+    REQUIRE_FALSE(quad.computeTimeOfImpact(floor, {2, -0.005}, 0.01));
+    REQUIRE(*quad.computeTimeOfImpact(floor, {2, -0.02}, 0.01) == doctest::Approx(0.5));
+  }
+
+  SUBCASE("Matches collision checks along the path") {
+    const ConvexBoundingPolygon triangle{{1, 1}, {3, 1.5}, {1.5, 3}};
+    const glm::vec2 motion{3, 2.5};
+    const auto time_of_impact = quad.computeTimeOfImpact(triangle, motion);
+    REQUIRE(time_of_impact);
+
+    auto moved_quad = quad;
+    moved_quad.setPosition(motion * (*time_of_impact - 0.01f));
+    REQUIRE_FALSE(moved_quad.collidesWith(triangle));
+    moved_quad.setPosition(motion * (*time_of_impact + 0.01f));
+    REQUIRE(moved_quad.collidesWith(triangle));
+  }
+
+  SUBCASE("Polygons without vertices") {
+    REQUIRE_FALSE(quad.computeTimeOfImpact(ConvexBoundingPolygon{}, {1, 1}));
+    REQUIRE_FALSE(ConvexBoundingPolygon{}.computeTimeOfImpact(quad, {1, 1}));
+  }
+}
+
+TEST_CASE("Smallest extent of polygons") {
+  REQUIRE(quad.computeSmallestExtent() == doctest::Approx(2));
+  REQUIRE(ConvexBoundingPolygon{{0, 0}, {4, 0}, {4, 0.5}, {0, 0.5}}.computeSmallestExtent() ==
+          doctest::Approx(0.5));
+  REQUIRE(ConvexBoundingPolygon{{0, 0}, {4, 0}, {0, 3}}.computeSmallestExtent() ==
+          doctest::Approx(2.4));
+  REQUIRE(ConvexBoundingPolygon{{0, 0}, {3, 3}}.computeSmallestExtent() == 0);
+  REQUIRE(ConvexBoundingPolygon{{2, 1}}.computeSmallestExtent() == 0);
+  REQUIRE(ConvexBoundingPolygon{Geometry::VertexList{}}.computeSmallestExtent() == 0);
+
+  SUBCASE("Rotated thin polygon") {
+    ConvexBoundingPolygon sliver{{-5, -0.1}, {5, -0.1}, {5, 0.1}, {-5, 0.1}};
+    sliver.setOrientation(glm::pi<float>() / 4);
+    REQUIRE(sliver.computeSmallestExtent() == doctest::Approx(0.2));
+  }
+}
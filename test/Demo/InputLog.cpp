@@ -0,0 +1,94 @@
+/** @file
+ * Tests recording and reading the input of a game session.
+ */
+
+#include <InputLog.hpp>
+#include <doctest/doctest.h>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+using namespace GameEngine;
+
+namespace {
+/** @return A log containing only its header and the given raw record. */
+std::string makeLogWithRecord(const char type, const uint64_t tick) {
+  std::ostringstream stream;
+  InputLogWriter writer{stream};
+  stream.put(type);
+  for (size_t index = 0; index < sizeof(tick); ++index) {
+    stream.put(static_cast<char>((tick >> (index * 8)) & 0xff));
+  }
+  return stream.str();
+}
+} // namespace
+
+TEST_CASE("InputLog reads the records it has written") {
+  std::ostringstream output;
+  InputLogWriter writer{output};
+  writer.write(InputEvent{0, InputCommand::RunRight});
+  writer.write(StateHash{1, 0x0123456789abcdef});
+  writer.write(InputEvent{1, InputCommand::AddStaticBox, {2.5, -3}});
+  writer.write(InputEvent{1, InputCommand::Jump});
+  writer.write(StateHash{2, 42});
+
+  std::istringstream input{output.str()};
+  const auto log = readInputLog(input);
+  REQUIRE(log.events.size() == 3);
+  REQUIRE(log.events[0].tick == 0);
+  REQUIRE(log.events[0].command == InputCommand::RunRight);
+  REQUIRE(log.events[1].tick == 1);
+  REQUIRE(log.events[1].command == InputCommand::AddStaticBox);
+  REQUIRE(log.events[1].world_position == glm::vec2{2.5, -3});
+  REQUIRE(log.events[2].tick == 1);
+  REQUIRE(log.events[2].command == InputCommand::Jump);
+  REQUIRE(log.state_hashes.size() == 2);
+  REQUIRE(log.state_hashes[0].tick == 1);
+  REQUIRE(log.state_hashes[0].value == 0x0123456789abcdef);
+  REQUIRE(log.state_hashes[1].tick == 2);
+  REQUIRE(log.state_hashes[1].value == 42);
+}
+
+TEST_CASE("InputLog rejects invalid logs") {
+  SUBCASE("wrong header") {
+    std::istringstream input{"GEIX"};
+    REQUIRE_THROWS_AS(readInputLog(input), std::runtime_error);
+  }
+  SUBCASE("truncated record") {
+    std::ostringstream output;
+    InputLogWriter writer{output};
+    writer.write(InputEvent{3, InputCommand::AddDynamicBox, {1, 2}});
+    const auto log = output.str();
+
+    std::istringstream input{log.substr(0, log.size() - 1)};
+    REQUIRE_THROWS_AS(readInputLog(input), std::runtime_error);
+  }
+  SUBCASE("unknown record type") {
+    std::istringstream input{makeLogWithRecord(0x7f, 0)};
+    REQUIRE_THROWS_AS(readInputLog(input), std::runtime_error);
+  }
+  SUBCASE("events out of order") {
+    std::ostringstream output;
+    InputLogWriter writer{output};
+    writer.write(InputEvent{5, InputCommand::Jump});
+    writer.write(InputEvent{4, InputCommand::Jump});
+
+    std::istringstream input{output.str()};
+    REQUIRE_THROWS_AS(readInputLog(input), std::runtime_error);
+  }
+  SUBCASE("state hashes out of order") {
+    std::ostringstream output;
+    InputLogWriter writer{output};
+    writer.write(StateHash{5, 1});
+    writer.write(InputEvent{6, InputCommand::Jump});
+    writer.write(StateHash{4, 1});
+
+    std::istringstream input{output.str()};
+    REQUIRE_THROWS_AS(readInputLog(input), std::runtime_error);
+  }
+  SUBCASE("tick beyond the maximal replay length") {
+    std::istringstream input{
+        makeLogWithRecord(static_cast<char>(InputCommand::Reset), input_log_tick_max + 1)};
+    REQUIRE_THROWS_AS(readInputLog(input), std::runtime_error);
+  }
+}
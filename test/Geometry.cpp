@@ -18,7 +18,7 @@ TEST_CASE("Traverse polygon using forEachEdge()") {
 
   SUBCASE("Two vertices") {
     size_t edges_traversed = 0;
-    std::vector<glm::vec2> line{{-5, 12}, {6.5, 11}};
+    VertexList line{{-5, 12}, {6.5, 11}};
     forEachEdge(line, [&](const glm::vec2 start, const glm::vec2 end) {
       REQUIRE(start.x == doctest::Approx(-5));
       REQUIRE(start.y == doctest::Approx(12));
@@ -31,7 +31,7 @@ TEST_CASE("Traverse polygon using forEachEdge()") {
 
   SUBCASE("Three vertices") {
     size_t edges_traversed = 0;
-    std::vector<glm::vec2> triangle{{-5, 12}, {-4, -9}, {6.5, -11}};
+    VertexList triangle{{-5, 12}, {-4, -9}, {6.5, -11}};
     forEachEdge(triangle, [&](const glm::vec2 start, const glm::vec2 end) {
       if (edges_traversed == 0) {
         REQUIRE(start.x == doctest::Approx(-5));
@@ -57,7 +57,7 @@ TEST_CASE("Traverse polygon using forEachEdge()") {
 
   SUBCASE("Four vertices") {
     size_t edges_traversed = 0;
-    std::vector<glm::vec2> uneven_quad = {{-5, 12}, {-4, -9}, {6.5, -11}, {5, 9.5}};
+    VertexList uneven_quad = {{-5, 12}, {-4, -9}, {6.5, -11}, {5, 9.5}};
     forEachEdge(uneven_quad, [&](const glm::vec2 start, const glm::vec2 end) {
       if (edges_traversed == 0) {
         REQUIRE(start.x == doctest::Approx(-5));
@@ -86,3 +86,93 @@ TEST_CASE("Traverse polygon using forEachEdge()") {
     REQUIRE(edges_traversed == 4);
   }
 }
+
+TEST_CASE("Traverse polygon using edges()") {
+  SUBCASE("Zero vertices") {
+    const auto range = edges({});
+    REQUIRE(range.size() == 0);
+    REQUIRE(range.begin() == range.end());
+  }
+
+  SUBCASE("One vertex") {
+    const VertexList point{{1, 21}};
+    REQUIRE(edges(point).size() == 0);
+    REQUIRE(edges(point).begin() == edges(point).end());
+  }
+
+  SUBCASE("Matches getEdge()") {
+    for (const VertexList &polygon :
+         {VertexList{{-5, 12}, {6.5, 11}}, VertexList{{-5, 12}, {-4, -9}, {6.5, -11}},
+          VertexList{{-5, 12}, {-4, -9}, {6.5, -11}, {5, 9.5}}}) {
+      size_t edge_index = 0;
+      for (const auto [start, end] : edges(polygon)) {
+        const auto [expected_start, expected_end] = getEdge(polygon, edge_index);
+        REQUIRE(start.x == expected_start.x);
+        REQUIRE(start.y == expected_start.y);
+        REQUIRE(end.x == expected_end.x);
+        REQUIRE(end.y == expected_end.y);
+        edge_index++;
+      }
+      REQUIRE(edge_index == countEdges(polygon));
+      REQUIRE(edges(polygon).size() == countEdges(polygon));
+    }
+  }
+}
+
+TEST_CASE("Traverse polygon using type-erased forEachEdge()") {
+  const VertexList triangle{{-5, 12}, {-4, -9}, {6.5, -11}};
+  size_t edges_traversed = 0;
+  const std::function<void(glm::vec2, glm::vec2)> function = [&](const glm::vec2 start,
+                                                                  const glm::vec2 end) {
+    REQUIRE(start.x == doctest::Approx(triangle[edges_traversed].x));
+    REQUIRE(end.x == doctest::Approx(triangle[(edges_traversed + 1) % 3].x));
+    edges_traversed++;
+  };
+  forEachEdge(triangle, function);
+  REQUIRE(edges_traversed == 3);
+}
+
+TEST_CASE("Intersect line segments with bounding boxes") {
+  const BoundingBox box{{1, 1}, {3, 2}};
+
+  REQUIRE(*intersectSegment({0, 1.5}, {4, 1.5}, box) == doctest::Approx(0.25));
+  REQUIRE(*intersectSegment({4, 1.5}, {0, 1.5}, box) == doctest::Approx(0.25));
+  REQUIRE(*intersectSegment({2, 0}, {2, 4}, box) == doctest::Approx(0.25));
+  REQUIRE(*intersectSegment({2, 1.5}, {10, 10}, box) == doctest::Approx(0));
+  REQUIRE(*intersectSegment({0, 1}, {4, 1}, box) == doctest::Approx(0.25));
+  REQUIRE_FALSE(intersectSegment({0, 1.5}, {0.5, 1.5}, box));
+  REQUIRE_FALSE(intersectSegment({0, 3}, {4, 3}, box));
+  REQUIRE_FALSE(intersectSegment({0, 2}, {1, 3}, box));
+}
+
+TEST_CASE("Intersect line segments with polygons") {
+  SUBCASE("Triangle in both winding orders") {
+    for (const auto &triangle : {VertexList{{0, 0}, {4, 0}, {0, 4}},
+                                 VertexList{{0, 0}, {0, 4}, {4, 0}}}) {
+      REQUIRE(*intersectSegment({-2, 1}, {6, 1}, triangle) == doctest::Approx(0.25));
+      REQUIRE(*intersectSegment({4, 4}, {0, 0}, triangle) == doctest::Approx(0.5));
+      REQUIRE(*intersectSegment({1, 1}, {6, 6}, triangle) == doctest::Approx(0));
+      REQUIRE_FALSE(intersectSegment({3, 3}, {6, 6}, triangle));
+      REQUIRE_FALSE(intersectSegment({-2, -1}, {6, -1}, triangle));
+    }
+  }
+
+  SUBCASE("Line") {
+    const VertexList line{{0, 0}, {0, 2}};
+    REQUIRE(*intersectSegment({-1, 1}, {3, 1}, line) == doctest::Approx(0.25));
+    REQUIRE(*intersectSegment({3, 2}, {-1, 2}, line) == doctest::Approx(0.75));
+    REQUIRE_FALSE(intersectSegment({-1, 3}, {3, 3}, line));
+    REQUIRE_FALSE(intersectSegment({1, 0}, {1, 2}, line));
+  }
+
+  SUBCASE("Collinear line") {
+    const VertexList line{{2, 0}, {4, 0}};
+    REQUIRE(*intersectSegment({0, 0}, {8, 0}, line) == doctest::Approx(0.25));
+    REQUIRE(*intersectSegment({3, 0}, {8, 0}, line) == doctest::Approx(0));
+    REQUIRE_FALSE(intersectSegment({5, 0}, {8, 0}, line));
+  }
+
+  SUBCASE("Single point") {
+    REQUIRE_FALSE(intersectSegment({-1, 0}, {1, 0}, VertexList{{0, 0}}));
+  }
+}
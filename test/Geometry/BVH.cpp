@@ -0,0 +1,143 @@
+/** @file
+ * Tests the bounding volume hierarchy.
+ */
+
+#include <GameEngine/Geometry/BVH.hpp>
+#include <doctest/doctest.h>
+
+using namespace GameEngine::Geometry;
+
+namespace {
+std::vector<size_t> queryArea(const BVH &bvh, const BoundingBox &area) {
+  std::vector<size_t> result;
+  bvh.queryArea(area, result);
+  return result;
+}
+
+std::vector<size_t> queryPoint(const BVH &bvh, const glm::vec2 point) {
+  std::vector<size_t> result;
+  bvh.queryPoint(point, result);
+  return result;
+}
+
+/** Rows of unit boxes with a gap of one unit between each other. */
+std::vector<BoundingBox> makeBoxGrid(const size_t columns, const size_t rows) {
+  std::vector<BoundingBox> bounding_boxes;
+  for (size_t row = 0; row < rows; ++row) {
+    for (size_t column = 0; column < columns; ++column) {
+      const glm::vec2 min{column * 2.0f, row * 2.0f};
+      bounding_boxes.push_back({min, min + glm::vec2{1, 1}});
+    }
+  }
+  return bounding_boxes;
+}
+
+/** Find the first box hit by the given segment. */
+std::optional<BVH::RaycastHit> raycast(const BVH &bvh,
+                                       const std::vector<BoundingBox> &bounding_boxes,
+                                       const glm::vec2 start, const glm::vec2 end) {
+  return bvh.raycast(start, end, [&](const size_t index) {
+    return intersectSegment(start, end, bounding_boxes[index]);
+  });
+}
+} // namespace
+
+TEST_CASE("BVH without entries") {
+  BVH bvh;
+  bvh.build({});
+  REQUIRE(bvh.size() == 0);
+
+  std::vector<size_t> result{1, 2};
+  bvh.queryArea({{-10, -10}, {10, 10}}, result);
+  REQUIRE(result.empty());
+  REQUIRE(queryPoint(bvh, {0, 0}).empty());
+  REQUIRE_FALSE(bvh.raycast({-10, 0}, {10, 0}, [](size_t) { return 0.0f; }));
+}
+
+TEST_CASE("BVH finds entries in an area") {
+  const auto bounding_boxes = makeBoxGrid(10, 10);
+  BVH bvh;
+  bvh.build(bounding_boxes);
+  REQUIRE(bvh.size() == 100);
+
+  SUBCASE("Matches a linear scan") {
+    for (const BoundingBox area : {BoundingBox{{0.5, 0.5}, {4.5, 2.5}},
+                                   BoundingBox{{-5, -5}, {30, 30}},
+                                   BoundingBox{{1.25, 1.25}, {1.75, 1.75}},
+                                   BoundingBox{{17.5, 17.5}, {18.5, 18.5}}}) {
+      std::vector<size_t> expected;
+      for (size_t index = 0; index < bounding_boxes.size(); ++index) {
+        if (overlaps(area, bounding_boxes[index])) {
+          expected.push_back(index);
+        }
+      }
+      REQUIRE(queryArea(bvh, area) == expected);
+    }
+  }
+
+  SUBCASE("Boxes which only touch the area don't overlap") {
+    REQUIRE(queryArea(bvh, {{1, 0}, {2, 1}}).empty());
+  }
+
+  SUBCASE("Points on the border are contained") {
+    REQUIRE(queryPoint(bvh, {2, 2}) == std::vector<size_t>{11});
+    REQUIRE(queryPoint(bvh, {3, 3}) == std::vector<size_t>{11});
+    REQUIRE(queryPoint(bvh, {1.5, 1.5}).empty());
+  }
+}
+
+TEST_CASE("BVH finds the closest entry along a line segment") {
+  const auto bounding_boxes = makeBoxGrid(10, 1);
+  BVH bvh;
+  bvh.build(bounding_boxes);
+
+  SUBCASE("Forwards") {
+    const auto hit = raycast(bvh, bounding_boxes, {-1, 0.5}, {30, 0.5});
+    REQUIRE(hit);
+    REQUIRE(hit->index == 0);
+    REQUIRE(hit->fraction == doctest::Approx(1.0 / 31));
+  }
+
+  SUBCASE("Backwards") {
+    const auto hit = raycast(bvh, bounding_boxes, {30, 0.5}, {-1, 0.5});
+    REQUIRE(hit);
+    REQUIRE(hit->index == 9);
+    REQUIRE(hit->fraction == doctest::Approx(11.0 / 31));
+  }
+
+  SUBCASE("Starting inside an entry") {
+    const auto hit = raycast(bvh, bounding_boxes, {4.5, 0.5}, {30, 0.5});
+    REQUIRE(hit);
+    REQUIRE(hit->index == 2);
+    REQUIRE(hit->fraction == doctest::Approx(0));
+  }
+
+  SUBCASE("Segment ends in a gap") {
+    REQUIRE_FALSE(raycast(bvh, bounding_boxes, {1.25, 0.5}, {1.75, 0.5}));
+  }
+
+  SUBCASE("Entries can reject hits of their bounding box") {
+    const auto hit = bvh.raycast({-1, 0.5}, {30, 0.5}, [&](const size_t index) {
+      return index < 5 ? std::nullopt
+                       : intersectSegment({-1, 0.5}, {30, 0.5}, bounding_boxes[index]);
+    });
+    REQUIRE(hit);
+    REQUIRE(hit->index == 5);
+  }
+}
+
+TEST_CASE("BVH refit") {
+  auto bounding_boxes = makeBoxGrid(8, 8);
+  BVH bvh;
+  bvh.build(bounding_boxes);
+
+  bounding_boxes[0] = {{40, 40}, {41, 41}};
+  bvh.refit(0, bounding_boxes[0]);
+  REQUIRE(queryPoint(bvh, {0.5, 0.5}).empty());
+  REQUIRE(queryPoint(bvh, {40.5, 40.5}) == std::vector<size_t>{0});
+  REQUIRE(queryArea(bvh, {{-1, -1}, {50, 50}}).size() == 64);
+
+  const auto hit = raycast(bvh, bounding_boxes, {50, 40.5}, {0, 40.5});
+  REQUIRE(hit);
+  REQUIRE(hit->index == 0);
+}
@@ -0,0 +1,134 @@
+/** @file
+ * Tests the spatial hash grid.
+ */
+
+#include <GameEngine/Geometry/SpatialHashGrid.hpp>
+#include <doctest/doctest.h>
+#include <limits>
+
+using namespace GameEngine::Geometry;
+
+namespace {
+std::vector<size_t> query(const SpatialHashGrid &grid, const BoundingBox &bounding_box) {
+  std::vector<size_t> result;
+  grid.query(bounding_box, result);
+  return result;
+}
+} // namespace
+
+TEST_CASE("Spatial hash grid cell size") {
+  REQUIRE(SpatialHashGrid{2.5}.getCellSize() == doctest::Approx(2.5));
+  REQUIRE(SpatialHashGrid{-3}.getCellSize() > 0);
+}
+
+TEST_CASE("Spatial hash grid finds entries in overlapping cells") {
+  SpatialHashGrid grid{1};
+  grid.insert(0, {{0.25, 0.25}, {0.75, 0.75}});
+  grid.insert(3, {{5.25, 5.25}, {5.75, 5.75}});
+  grid.insert(2, {{-0.75, -0.75}, {0.5, 0.5}});
+
+  SUBCASE("Empty area") { REQUIRE(query(grid, {{10, 10}, {11, 11}}).empty()); }
+
+  SUBCASE("Single cell") {
+    REQUIRE(query(grid, {{5.1, 5.1}, {5.2, 5.2}}) == std::vector<size_t>{3});
+  }
+
+  SUBCASE("Result is sorted and contains no duplicates") {
+    REQUIRE(query(grid, {{-1, -1}, {6, 6}}) == std::vector<size_t>{0, 2, 3});
+  }
+
+  SUBCASE("Negative coordinates") {
+    REQUIRE(query(grid, {{-0.5, -0.5}, {-0.25, -0.25}}) == std::vector<size_t>{2});
+  }
+}
+
+TEST_CASE("Spatial hash grid updates moved entries") {
+  SpatialHashGrid grid{1};
+  grid.insert(0, {{0.25, 0.25}, {0.75, 0.75}});
+  grid.insert(0, {{7.25, 0.25}, {7.75, 0.75}});
+
+  REQUIRE(query(grid, {{0.1, 0.1}, {0.9, 0.9}}).empty());
+  REQUIRE(query(grid, {{7.1, 0.1}, {7.9, 0.9}}) == std::vector<size_t>{0});
+}
+
+TEST_CASE("Spatial hash grid entries covering multiple cells") {
+  SpatialHashGrid grid{1};
+  grid.insert(1, {{0, -10}, {0, 10}});
+
+  REQUIRE(query(grid, {{0.1, -9.5}, {0.2, -9.4}}) == std::vector<size_t>{1});
+  REQUIRE(query(grid, {{0.1, 9.5}, {0.2, 9.6}}) == std::vector<size_t>{1});
+  REQUIRE(query(grid, {{-3, -3}, {3, 3}}) == std::vector<size_t>{1});
+}
+
+TEST_CASE("Spatial hash grid queries huge areas") {
+  SpatialHashGrid grid{1};
+  grid.insert(0, {{-5000, -5000}, {-4999, -4999}});
+  grid.insert(1, {{0.5, 0.5}, {1.5, 1.5}});
+  grid.insert(2, {{7000, 2}, {7001, 3}});
+
+  const auto infinity = std::numeric_limits<float>::infinity();
+  REQUIRE(query(grid, {{-infinity, -infinity}, {infinity, infinity}}) ==
+          std::vector<size_t>{0, 1, 2});
+  REQUIRE(query(grid, {{-1e6, -1e6}, {1e6, 1}}) == std::vector<size_t>{0, 1});
+}
+
+TEST_CASE("Spatial hash grid stores huge entries without visiting all their cells") {
+  SpatialHashGrid grid{1};
+  grid.insert(0, {{0.25, 0.25}, {0.75, 0.75}});
+  grid.insert(1, {{-1e30, -1e30}, {1e30, 1e30}});
+  grid.insert(2, {{-100, 0.5}, {100, 10.5}});
+  REQUIRE(query(grid, {{0.5, 0.5}, {0.6, 0.6}}) == std::vector<size_t>{0, 1, 2});
+  REQUIRE(query(grid, {{-50, -5}, {-49, -4}}) == std::vector<size_t>{1});
+
+  SUBCASE("Moving huge entries") {
+    grid.insert(2, {{-100, 20.5}, {100, 30.5}});
+    REQUIRE(query(grid, {{0.5, 0.5}, {0.6, 0.6}}) == std::vector<size_t>{0, 1});
+    REQUIRE(query(grid, {{0.5, 25}, {0.6, 25}}) == std::vector<size_t>{1, 2});
+  }
+
+  SUBCASE("Shrinking huge entries") {
+    grid.insert(2, {{0.5, 0.5}, {0.6, 0.6}});
+    REQUIRE(query(grid, {{0.5, 25}, {0.6, 25}}) == std::vector<size_t>{1});
+    REQUIRE(query(grid, {{0.5, 0.5}, {0.6, 0.6}}) == std::vector<size_t>{0, 1, 2});
+  }
+
+  SUBCASE("Removing huge entries") {
+    grid.remove(1);
+    REQUIRE(query(grid, {{0.5, 0.5}, {0.6, 0.6}}) == std::vector<size_t>{0, 2});
+    REQUIRE(query(grid, {{-50, -5}, {-49, -4}}).empty());
+  }
+}
+
+TEST_CASE("Spatial hash grid maps NaN coordinates to the cell at the origin") {
+  SpatialHashGrid grid{1};
+  grid.insert(0, {{0.25, 0.25}, {0.75, 0.75}});
+  grid.insert(1, {{-2.5, -2.5}, {-1.5, -1.5}});
+
+  const auto nan = std::numeric_limits<float>::quiet_NaN();
+  REQUIRE(query(grid, {{nan, nan}, {nan, nan}}) == std::vector<size_t>{0});
+  REQUIRE(query(grid, {{-3, -3}, {nan, nan}}) == std::vector<size_t>{0, 1});
+
+  grid.insert(2, {{nan, 0.5}, {0.5, nan}});
+  REQUIRE(query(grid, {{0.5, 0.5}, {0.5, 0.5}}) == std::vector<size_t>{0, 2});
+}
+
+TEST_CASE("Spatial hash grid removes entries") {
+  SpatialHashGrid grid{1};
+  grid.insert(0, {{0.25, 0.25}, {0.75, 0.75}});
+  grid.insert(1, {{0.5, 0.5}, {1.5, 1.5}});
+
+  SUBCASE("Remove single entry") {
+    grid.remove(0);
+    REQUIRE(query(grid, {{0, 0}, {2, 2}}) == std::vector<size_t>{1});
+  }
+
+  SUBCASE("Removing unknown entries does nothing") {
+    grid.remove(7);
+    REQUIRE(query(grid, {{0, 0}, {2, 2}}) == std::vector<size_t>{0, 1});
+  }
+
+  SUBCASE("Remove all entries") {
+    grid.clear();
+    REQUIRE(query(grid, {{0, 0}, {2, 2}}).empty());
+  }
+}
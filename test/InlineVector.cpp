@@ -0,0 +1,78 @@
+/** @file
+ * Tests the inline vector container.
+ */
+
+#include <GameEngine/InlineVector.hpp>
+#include <doctest/doctest.h>
+#include <numeric>
+
+using namespace GameEngine;
+
+TEST_CASE("InlineVector stores small amounts of elements inline") {
+  InlineVector<int, 4> vector;
+  REQUIRE(vector.empty());
+  REQUIRE_FALSE(vector.isOnHeap());
+
+  vector.push_back(7);
+  vector.push_back(-2);
+  vector.push_back(5);
+  vector.push_back(1);
+  REQUIRE(vector.size() == 4);
+  REQUIRE_FALSE(vector.isOnHeap());
+  REQUIRE(vector.front() == 7);
+  REQUIRE(vector.back() == 1);
+  REQUIRE(vector[1] == -2);
+  REQUIRE(std::accumulate(vector.cbegin(), vector.cend(), 0) == 11);
+}
+
+TEST_CASE("InlineVector falls back to the heap when exceeding its inline capacity") {
+  InlineVector<int, 2> vector{3, 4};
+  REQUIRE_FALSE(vector.isOnHeap());
+
+  vector.push_back(5);
+  REQUIRE(vector.isOnHeap());
+  REQUIRE(vector.size() == 3);
+  REQUIRE(vector.at(0) == 3);
+  REQUIRE(vector.at(1) == 4);
+  REQUIRE(vector.at(2) == 5);
+
+  SUBCASE("Copies preserve all elements") {
+    const auto copy = vector;
+    REQUIRE(copy.size() == 3);
+    REQUIRE(copy.back() == 5);
+  }
+
+  SUBCASE("Clearing returns to inline storage") {
+    vector.clear();
+    REQUIRE(vector.empty());
+    REQUIRE_FALSE(vector.isOnHeap());
+    vector.push_back(9);
+    REQUIRE(vector.size() == 1);
+    REQUIRE(vector.front() == 9);
+  }
+}
+
+TEST_CASE("InlineVector bounds checking") {
+  const InlineVector<int, 2> vector{1};
+  REQUIRE(vector.at(0) == 1);
+  REQUIRE_THROWS(vector.at(1));
+}
+
+TEST_CASE("InlineVector resizing") {
+  InlineVector<int, 3> vector{1, 2, 3};
+
+  SUBCASE("Shrink") {
+    vector.resize(1);
+    REQUIRE(vector.size() == 1);
+    REQUIRE(vector.front() == 1);
+  }
+
+  SUBCASE("Grow beyond inline capacity") {
+    vector.resize(5);
+    REQUIRE(vector.isOnHeap());
+    REQUIRE(vector.size() == 5);
+    REQUIRE(vector.at(2) == 3);
+    REQUIRE(vector.at(3) == 0);
+    REQUIRE(vector.at(4) == 0);
+  }
+}
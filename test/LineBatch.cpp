@@ -0,0 +1,82 @@
+/** @file
+ * Tests batched line rendering.
+ */
+
+#include <GameEngine/LineBatch.hpp>
+#include <algorithm>
+#include <cmath>
+#include <doctest/doctest.h>
+
+using namespace GameEngine;
+
+namespace {
+bool operator==(const SDL_Color &a, const SDL_Color &b) {
+  return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a;
+}
+} // namespace
+
+TEST_CASE("LineBatch stores each line as a quad") {
+  LineBatch line_batch;
+  line_batch.addLine({10, 20}, {30, 20});
+  REQUIRE(line_batch.getVertices().size() == 4);
+  REQUIRE(line_batch.getIndices() == std::vector<int>{0, 1, 2, 0, 2, 3});
+
+  float min_x = 1000, max_x = -1000, min_y = 1000, max_y = -1000;
+  for (const auto &vertex : line_batch.getVertices()) {
+    min_x = std::min(min_x, vertex.position.x);
+    max_x = std::max(max_x, vertex.position.x);
+    min_y = std::min(min_y, vertex.position.y);
+    max_y = std::max(max_y, vertex.position.y);
+    REQUIRE(vertex.color == SDL_Color{255, 255, 255, 255});
+  }
+  REQUIRE(min_x == doctest::Approx(9.5));
+  REQUIRE(max_x == doctest::Approx(30.5));
+  REQUIRE(min_y == doctest::Approx(19.5));
+  REQUIRE(max_y == doctest::Approx(20.5));
+}
+
+TEST_CASE("LineBatch applies colors to subsequent lines") {
+  LineBatch line_batch;
+  line_batch.addLine({0, 0}, {0, 5});
+  line_batch.setColor({255, 0, 0, 255});
+  line_batch.addLine({0, 0}, {5, 5});
+
+  const auto &vertices = line_batch.getVertices();
+  REQUIRE(vertices.size() == 8);
+  REQUIRE(vertices[3].color == SDL_Color{255, 255, 255, 255});
+  REQUIRE(vertices[4].color == SDL_Color{255, 0, 0, 255});
+  REQUIRE(line_batch.getIndices().back() == 7);
+}
+
+TEST_CASE("LineBatch draws zero length lines as single pixel") {
+  LineBatch line_batch;
+  line_batch.addLine({3, 3}, {3, 3});
+  for (const auto &vertex : line_batch.getVertices()) {
+    REQUIRE(std::abs(vertex.position.x - 3) == doctest::Approx(0.5));
+    REQUIRE(std::abs(vertex.position.y - 3) == doctest::Approx(0.5));
+  }
+}
+
+TEST_CASE("LineBatch adds all edges of polygons") {
+  LineBatch line_batch;
+
+  SUBCASE("Point") {
+    line_batch.addPolygon({{1, 1}});
+    REQUIRE(line_batch.getVertices().empty());
+  }
+
+  SUBCASE("Line") {
+    line_batch.addPolygon({{1, 1}, {2, 2}});
+    REQUIRE(line_batch.getVertices().size() == 4);
+  }
+
+  SUBCASE("Triangle") {
+    line_batch.addPolygon({{1, 1}, {2, 2}, {3, 1}});
+    REQUIRE(line_batch.getVertices().size() == 12);
+    REQUIRE(line_batch.getIndices().size() == 18);
+  }
+
+  line_batch.clear();
+  REQUIRE(line_batch.getVertices().empty());
+  REQUIRE(line_batch.getIndices().empty());
+}
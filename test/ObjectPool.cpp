@@ -0,0 +1,130 @@
+/** @file
+ * Tests the object pool container.
+ */
+
+#include <GameEngine/ObjectPool.hpp>
+#include <doctest/doctest.h>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+using namespace GameEngine;
+
+namespace {
+/** Counts its living instances. */
+class Tracked {
+public:
+  Tracked(std::string name, int &instance_count)
+      : name{std::move(name)}, instance_count{instance_count} {
+    ++instance_count;
+  }
+  ~Tracked() { --instance_count; }
+  Tracked(const Tracked &) = delete;
+  Tracked &operator=(const Tracked &) = delete;
+
+  std::string name;
+
+private:
+  int &instance_count;
+};
+} // namespace
+
+TEST_CASE("ObjectPool creates and destroys objects") {
+  int instance_count = 0;
+  ObjectPool<Tracked, 4> pool;
+  REQUIRE(pool.size() == 0);
+  REQUIRE(pool.capacity() == 0);
+
+  const auto first = pool.create("first", instance_count);
+  const auto second = pool.create("second", instance_count);
+  REQUIRE(pool.size() == 2);
+  REQUIRE(pool.capacity() == 4);
+  REQUIRE(instance_count == 2);
+  REQUIRE(pool.get(first)->name == "first");
+  REQUIRE(pool.get(second)->name == "second");
+
+  pool.destroy(first);
+  REQUIRE(pool.size() == 1);
+  REQUIRE(instance_count == 1);
+  REQUIRE(pool.get(first) == nullptr);
+  REQUIRE(pool.get(second)->name == "second");
+
+  SUBCASE("Destroying invalid handles does nothing") {
+    pool.destroy(first);
+    pool.destroy({});
+    REQUIRE(pool.size() == 1);
+    REQUIRE(pool.get({}) == nullptr);
+  }
+
+  SUBCASE("Freed slots get reused without invalidating old handles") {
+    const auto third = pool.create("third", instance_count);
+    REQUIRE(third.index == first.index);
+    REQUIRE(third != first);
+    REQUIRE(pool.get(first) == nullptr);
+    REQUIRE(pool.get(third)->name == "third");
+    REQUIRE(pool.capacity() == 4);
+  }
+
+  SUBCASE("Clearing destroys all objects and keeps the memory") {
+    pool.clear();
+    REQUIRE(pool.size() == 0);
+    REQUIRE(instance_count == 0);
+    REQUIRE(pool.get(second) == nullptr);
+    REQUIRE(pool.capacity() == 4);
+
+    const auto fourth = pool.create("fourth", instance_count);
+    REQUIRE(fourth.index == 0);
+    REQUIRE(pool.get(fourth)->name == "fourth");
+  }
+
+  SUBCASE("Destruction of the pool destroys all objects") {
+    {
+      ObjectPool<Tracked, 4> other_pool;
+      other_pool.create("other", instance_count);
+      REQUIRE(instance_count == 2);
+    }
+    REQUIRE(instance_count == 1);
+  }
+}
+
+TEST_CASE("ObjectPool keeps objects at the same address") {
+  int instance_count = 0;
+  ObjectPool<Tracked, 2> pool;
+  const auto first = pool.create("first", instance_count);
+  const auto *first_address = pool.get(first);
+  for (int index = 0; index < 9; ++index) {
+    pool.create(std::to_string(index), instance_count);
+  }
+  REQUIRE(pool.size() == 10);
+  REQUIRE(pool.capacity() == 10);
+  REQUIRE(pool.get(first) == first_address);
+
+  SUBCASE("Moving the pool keeps addresses and handles") {
+    const auto moved_pool = std::move(pool);
+    REQUIRE(moved_pool.size() == 10);
+    REQUIRE(moved_pool.get(first) == first_address);
+    REQUIRE(pool.size() == 0);
+    REQUIRE(pool.get(first) == nullptr);
+    REQUIRE(instance_count == 10);
+  }
+}
+
+TEST_CASE("ObjectPool leaves the free list untouched if construction fails") {
+  struct Throwing {
+    explicit Throwing(const bool should_throw) {
+      if (should_throw) {
+        throw std::runtime_error{"Construction failed"};
+      }
+    }
+  };
+
+  ObjectPool<Throwing> pool;
+  const auto first = pool.create(false);
+  pool.destroy(first);
+  REQUIRE_THROWS_AS(pool.create(true), std::runtime_error);
+  REQUIRE(pool.size() == 0);
+
+  const auto second = pool.create(false);
+  REQUIRE(second.index == first.index);
+  REQUIRE(pool.size() == 1);
+}
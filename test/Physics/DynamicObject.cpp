@@ -0,0 +1,128 @@
+/** @file
+ * Tests objects subject to gravity.
+ */
+
+#include <GameEngine/Physics/DynamicObject.hpp>
+#include <GameEngine/Physics/Integrator.hpp>
+#include <GameEngine/Physics/StaticObject.hpp>
+#include <doctest/doctest.h>
+
+using namespace GameEngine;
+using namespace std::chrono_literals;
+
+namespace {
+std::unique_ptr<Physics::Object> makeBox(const glm::vec2 center, const glm::vec2 half_size) {
+  return std::make_unique<Physics::DynamicObject>(std::initializer_list<glm::vec2>{
+      center - half_size, center + glm::vec2{half_size.x, -half_size.y}, center + half_size,
+      center + glm::vec2{-half_size.x, half_size.y}});
+}
+
+std::vector<std::unique_ptr<Physics::Object>> makeBoxOnFloor() {
+  std::vector<std::unique_ptr<Physics::Object>> objects;
+  objects.push_back(std::make_unique<Physics::StaticObject>(
+      std::initializer_list<glm::vec2>{{-5, -1}, {5, -1}, {5, 0}, {-5, 0}}));
+  objects.push_back(makeBox({0, 0.5}, {0.25, 0.25}));
+  return objects;
+}
+
+void integrateSeconds(Physics::Integrator &integrator,
+                      const std::vector<std::unique_ptr<Physics::Object>> &objects,
+                      const int seconds) {
+  for (int frame = 0; frame < seconds * 60; ++frame) {
+    integrator.integrate(16667us, objects);
+  }
+}
+} // namespace
+
+TEST_CASE("Physics::DynamicObject falls asleep while resting on the ground") {
+  auto objects = makeBoxOnFloor();
+  auto &box = static_cast<Physics::DynamicObject &>(*objects.back());
+  REQUIRE_FALSE(box.isSleeping());
+
+  Physics::Integrator integrator{};
+  integrateSeconds(integrator, objects, 2);
+  REQUIRE(box.isSleeping());
+  REQUIRE(box.isTouchingGround());
+  REQUIRE(box.getVelocity() == glm::vec2{0, 0});
+
+  const auto position = box.getBoundingPolygon().getPosition();
+  integrateSeconds(integrator, objects, 1);
+  REQUIRE(box.isSleeping());
+  REQUIRE(box.getBoundingPolygon().getPosition() == position);
+
+  SUBCASE("Setting the velocity wakes the object up") {
+    box.setVelocity({0, 0.5});
+    REQUIRE_FALSE(box.isSleeping());
+    integrator.integrate(17ms, objects);
+    REQUIRE(box.getBoundingPolygon().getPosition().y > position.y);
+  }
+
+  SUBCASE("Resting objects don't wake up sleeping objects below them") {
+    objects.push_back(makeBox(position + glm::vec2{0, 0.5}, {0.25, 0.25}));
+    integrateSeconds(integrator, objects, 2);
+    REQUIRE(box.isSleeping());
+    REQUIRE(box.getBoundingPolygon().getPosition() == position);
+    REQUIRE(objects.back()->isSleeping());
+  }
+
+  SUBCASE("Falling objects wake up sleeping objects") {
+    objects.push_back(makeBox(position + glm::vec2{0, 3}, {0.25, 0.25}));
+    bool woke_up = false;
+    for (int frame = 0; frame < 60 && !woke_up; ++frame) {
+      integrator.integrate(16667us, objects);
+      woke_up = !box.isSleeping();
+    }
+    REQUIRE(woke_up);
+  }
+}
+
+TEST_CASE("Physics::DynamicObject ignores small displacements while sleeping") {
+  auto objects = makeBoxOnFloor();
+  auto &box = static_cast<Physics::DynamicObject &>(*objects.back());
+  Physics::Integrator integrator{};
+  integrateSeconds(integrator, objects, 2);
+  REQUIRE(box.isSleeping());
+
+  const auto position = box.getBoundingPolygon().getPosition();
+  box.handleCollisionWith(*objects.front(), {0, -0.001});
+  REQUIRE(box.isSleeping());
+  REQUIRE(box.getBoundingPolygon().getPosition() == position);
+
+  box.handleCollisionWith(*objects.front(), {0.5, 0});
+  REQUIRE_FALSE(box.isSleeping());
+  REQUIRE(box.getBoundingPolygon().getPosition().x == doctest::Approx(position.x + 0.5));
+}
+
+TEST_CASE("Physics::DynamicObject wakes up when its ground moves away") {
+  auto objects = makeBoxOnFloor();
+  objects.push_back(makeBox({0, 1}, {0.25, 0.25}));
+  auto &lower_box = static_cast<Physics::DynamicObject &>(*objects[1]);
+  auto &upper_box = static_cast<Physics::DynamicObject &>(*objects[2]);
+  Physics::Integrator integrator{};
+  integrateSeconds(integrator, objects, 2);
+  REQUIRE(lower_box.isSleeping());
+  REQUIRE(upper_box.isSleeping());
+
+  lower_box.setVelocity({2, 0});
+  integrator.integrate(17ms, objects);
+  REQUIRE_FALSE(upper_box.isSleeping());
+}
+
+TEST_CASE("Physics::DynamicObject wakes up when its ground slides away slowly") {
+  auto objects = makeBoxOnFloor();
+  objects.push_back(makeBox({0, 1}, {0.25, 0.25}));
+  auto &lower_box = static_cast<Physics::DynamicObject &>(*objects[1]);
+  auto &upper_box = static_cast<Physics::DynamicObject &>(*objects[2]);
+  Physics::Integrator integrator{};
+  integrateSeconds(integrator, objects, 2);
+  REQUIRE(upper_box.isSleeping());
+
+  /* Slower than the speed at which moving objects wake up everything around them. */
+  lower_box.setGroundStickiness(0);
+  lower_box.setAirFriction(0);
+  lower_box.setVelocity({0.02, 0});
+  integrateSeconds(integrator, objects, 2);
+  REQUIRE(lower_box.getBoundingPolygon().getBoundingBox().min.x > 1);
+  REQUIRE(upper_box.getBoundingPolygon().getBoundingBox().min.y ==
+          doctest::Approx(0).epsilon(0.001));
+}
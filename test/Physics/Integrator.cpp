@@ -2,24 +2,147 @@
  * Tests the physics integrator.
  */
 
+#include <GameEngine/ObjectPool.hpp>
+#include <GameEngine/Physics/DynamicObject.hpp>
 #include <GameEngine/Physics/Integrator.hpp>
 #include <GameEngine/Physics/Object.hpp>
+#include <GameEngine/Physics/StaticObject.hpp>
 #include <doctest/doctest.h>
 #include <doctest/trompeloeil.hpp>
+#include <atomic>
+#include <cstdlib>
 #include <glm/geometric.hpp>
+#include <new>
 
 using namespace GameEngine;
 using namespace std::chrono_literals;
 
 namespace {
+/** Amount of calls to the global operator new, including calls from other threads. */
+std::atomic<size_t> allocation_count{0};
+} // namespace
+
+/* GCC inlines the replaced operators and warns about memory from operator new being released by
+ * free(), without seeing that it was allocated by malloc(). */
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void *operator new(const size_t size) {
+  ++allocation_count;
+  if (void *memory = std::malloc(size == 0 ? 1 : size)) {
+    return memory;
+  }
+  throw std::bad_alloc{};
+}
+
+void operator delete(void *memory) noexcept { std::free(memory); }
+
+void operator delete(void *memory, size_t) noexcept { std::free(memory); }
+
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic pop
+#endif
+
+namespace {
+const std::vector<Physics::Object *> no_objects;
+
 class MockObject : public Physics::Object {
   MAKE_MOCK0(update, void(), override);
   MAKE_CONST_MOCK0(getVelocity, glm::vec2(), override);
   MAKE_MOCK1(addVelocityOffset, void(glm::vec2), override);
   MAKE_CONST_MOCK0(getBoundingPolygon, const ConvexBoundingPolygon &(), override);
   MAKE_MOCK2(handleCollisionWith, void(Physics::Object &, glm::vec2), override);
-  MAKE_CONST_MOCK3(render, void(SDL_Renderer *, const Camera &, float), override);
+  MAKE_CONST_MOCK3(render, void(LineBatch &, const Camera &, float), override);
 };
+
+/** Counts how often the integrator accesses it. */
+class CountingStaticObject : public Physics::StaticObject {
+public:
+  using StaticObject::StaticObject;
+
+  const ConvexBoundingPolygon &getBoundingPolygon() const override {
+    ++polygon_requests;
+    return StaticObject::getBoundingPolygon();
+  }
+
+  void handleCollisionWith(Physics::Object &other, const glm::vec2 displacement_vector) override {
+    ++collisions;
+    StaticObject::handleCollisionWith(other, displacement_vector);
+  }
+
+  mutable size_t polygon_requests = 0;
+  size_t collisions = 0;
+};
+
+/** Records the position of each object colliding with it. */
+class RecordingStaticObject : public Physics::StaticObject {
+public:
+  using StaticObject::StaticObject;
+
+  void handleCollisionWith(Physics::Object &other, const glm::vec2 displacement_vector) override {
+    colliding_positions.push_back(other.getBoundingPolygon().getPosition());
+    StaticObject::handleCollisionWith(other, displacement_vector);
+  }
+
+  std::vector<glm::vec2> colliding_positions;
+};
+
+/** Moves at a constant velocity without reacting to collisions. */
+class KinematicBox : public Physics::Object {
+public:
+  KinematicBox(std::initializer_list<glm::vec2> vertices, const glm::vec2 velocity)
+      : bounding_polygon{vertices}, velocity{velocity} {}
+
+  void update() override {}
+  glm::vec2 getVelocity() const override { return velocity; }
+  void addVelocityOffset(const glm::vec2 offset) override {
+    bounding_polygon.setPosition(bounding_polygon.getPosition() + offset);
+  }
+  const ConvexBoundingPolygon &getBoundingPolygon() const override { return bounding_polygon; }
+  void handleCollisionWith(Physics::Object &, glm::vec2) override {}
+  Physics::BodyType getBodyType() const override { return Physics::BodyType::Kinematic; }
+  void render(LineBatch &, const Camera &, float) const override {}
+
+private:
+  ConvexBoundingPolygon bounding_polygon;
+  glm::vec2 velocity;
+};
+
+/** @return Boxes falling onto a floor, ordered so that islands interleave in the object list. */
+std::vector<std::unique_ptr<Physics::Object>> makeFallingBoxes() {
+  std::vector<std::unique_ptr<Physics::Object>> objects;
+  for (int column = 0; column < 8; ++column) {
+    const auto x = column * 3.0f;
+    objects.push_back(std::make_unique<Physics::StaticObject>(
+        std::initializer_list<glm::vec2>{{x - 1, -1}, {x + 1, -1}, {x + 1, 0}, {x - 1, 0}}));
+  }
+  for (int row = 0; row < 4; ++row) {
+    for (int column = 0; column < 8; ++column) {
+      const glm::vec2 center{column * 3.0f + row * 0.1f, 1 + row * 0.6f};
+      objects.push_back(std::make_unique<Physics::DynamicObject>(std::initializer_list<glm::vec2>{
+          center + glm::vec2{-0.25, -0.25}, center + glm::vec2{0.25, -0.25},
+          center + glm::vec2{0.25, 0.25}, center + glm::vec2{-0.25, 0.25}}));
+    }
+  }
+  return objects;
+}
+
+std::vector<glm::vec2> simulate(const size_t worker_count) {
+  auto objects = makeFallingBoxes();
+  Physics::Integrator integrator{};
+  integrator.setWorkerCount(worker_count);
+  for (int frame = 0; frame < 60; ++frame) {
+    integrator.integrate(17ms, objects);
+  }
+
+  std::vector<glm::vec2> positions;
+  for (const auto &object : objects) {
+    positions.push_back(object->getBoundingPolygon().getPosition());
+  }
+  return positions;
+}
 } // namespace
 
 TEST_CASE("Physics::Integrator consumes frame duration in ticks when updating objects") {
@@ -100,43 +223,21 @@ TEST_CASE("Physics::Integrator applies velocity properly") {
     Physics::Integrator{}.integrate(17ms, objects);
   }
 
-  SUBCASE("Large velocities are divided into multiple substeps") {
+  SUBCASE("Large velocities are applied in one step if nothing is in the way") {
     const glm::vec2 velocity{-0.343, 0.3};
-    const auto direction_step = glm::normalize(velocity) * 0.15f;
-    const auto last_step = glm::mod(velocity, direction_step);
     ALLOW_CALL(object, getVelocity()).RETURN(velocity);
-
-    trompeloeil::sequence sequence;
-    REQUIRE_CALL(object, addVelocityOffset(trompeloeil::_))
-        .IN_SEQUENCE(sequence)
-        .WITH(_1.x == doctest::Approx(direction_step.x))
-        .WITH(_1.y == doctest::Approx(direction_step.y))
-        .TIMES(3);
     REQUIRE_CALL(object, addVelocityOffset(trompeloeil::_))
-        .IN_SEQUENCE(sequence)
-        .WITH(_1.x == doctest::Approx(last_step.x)) /* Last remaining substep. */
-        .WITH(_1.y == doctest::Approx(last_step.y));
-
+        .WITH(_1.x == doctest::Approx(velocity.x))
+        .WITH(_1.y == doctest::Approx(velocity.y));
     Physics::Integrator{}.integrate(17ms, objects);
   }
 
-  SUBCASE("Applicable velocity has a limit per tick") {
+  SUBCASE("Applicable velocity has no limit per tick") {
     const glm::vec2 velocity{290, -950};
-    const auto direction_step = glm::normalize(velocity) * 0.15f;
-    const auto last_step = glm::mod(glm::normalize(velocity) * 2.5f, direction_step);
     ALLOW_CALL(object, getVelocity()).RETURN(velocity);
-
-    trompeloeil::sequence sequence;
-    REQUIRE_CALL(object, addVelocityOffset(trompeloeil::_))
-        .IN_SEQUENCE(sequence)
-        .WITH(_1.x == doctest::Approx(direction_step.x))
-        .WITH(_1.y == doctest::Approx(direction_step.y))
-        .TIMES(static_cast<size_t>(2.5 / 0.15));
     REQUIRE_CALL(object, addVelocityOffset(trompeloeil::_))
-        .IN_SEQUENCE(sequence)
-        .WITH(_1.x == doctest::Approx(last_step.x)) /* Last remaining substep. */
-        .WITH(_1.y == doctest::Approx(last_step.y));
-
+        .WITH(_1.x == doctest::Approx(velocity.x))
+        .WITH(_1.y == doctest::Approx(velocity.y));
     Physics::Integrator{}.integrate(17ms, objects);
   }
 
@@ -232,6 +333,10 @@ TEST_CASE(
   ALLOW_CALL(second_object, addVelocityOffset(trompeloeil::_));
   ALLOW_CALL(second_object, getBoundingPolygon()).RETURN(second_polygon);
 
+  /* Split the motion of both objects into multiple steps. */
+  Physics::Integrator integrator{};
+  integrator.setSubstepSafetyFactor(0.15);
+
   SUBCASE("Objects move without reacting to collision") {
     REQUIRE_CALL(first_object, handleCollisionWith(trompeloeil::_, trompeloeil::_))
         .WITH(_2.x == doctest::Approx(-0.5))
@@ -239,7 +344,7 @@ TEST_CASE(
     REQUIRE_CALL(second_object, handleCollisionWith(trompeloeil::_, trompeloeil::_))
         .WITH(_2.x == doctest::Approx(0.5))
         .TIMES(5);
-    Physics::Integrator{}.integrate(17ms, objects);
+    integrator.integrate(17ms, objects);
   }
 
   SUBCASE("Object responds to collision by moving out of other object") {
@@ -248,14 +353,369 @@ TEST_CASE(
         .LR_SIDE_EFFECT(first_polygon.setPosition({200, 200}));
     REQUIRE_CALL(second_object, handleCollisionWith(trompeloeil::_, trompeloeil::_))
         .WITH(_2.x == doctest::Approx(0.5));
+    integrator.integrate(17ms, objects);
+  }
+}
+
+TEST_CASE("Physics::Integrator sweeps fast objects towards their first contact") {
+  std::vector<std::unique_ptr<Physics::Object>> objects;
+  auto box = std::make_unique<Physics::DynamicObject>(
+      std::initializer_list<glm::vec2>{{-0.1, 4.9}, {0.1, 4.9}, {0.1, 5.1}, {-0.1, 5.1}});
+  auto &box_reference = *box;
+
+  SUBCASE("Falling onto a line") {
+    objects.push_back(std::make_unique<Physics::StaticObject>(
+        std::initializer_list<glm::vec2>{{-5, 0}, {5, 0}}));
+    box->setVelocity({0, -20});
+    objects.push_back(std::move(box));
+    Physics::Integrator{}.integrate(17ms, objects);
+
+    const auto &bounding_box = box_reference.getBoundingPolygon().getBoundingBox();
+    REQUIRE(bounding_box.min.y == doctest::Approx(0).epsilon(0.001));
+    REQUIRE(box_reference.isTouchingGround());
+  }
+
+  SUBCASE("Hitting a short line sideways") {
+    objects.push_back(std::make_unique<Physics::StaticObject>(
+        std::initializer_list<glm::vec2>{{3, 5.0625}, {3, 4.9375}}));
+    box->setGravity(0);
+    box->setVelocity({30, 0});
+    objects.push_back(std::move(box));
+    Physics::Integrator{}.integrate(17ms, objects);
+
+    const auto &bounding_box = box_reference.getBoundingPolygon().getBoundingBox();
+    REQUIRE(bounding_box.max.x == doctest::Approx(3).epsilon(0.001));
+    REQUIRE(box_reference.isTouchingWall());
+  }
+
+  SUBCASE("Sliding along a slope") {
+    objects.push_back(std::make_unique<Physics::StaticObject>(
+        std::initializer_list<glm::vec2>{{-10, 13.8}, {10, -6.2}, {-10, -6.2}}));
+    box->setGravity(0);
+    box->setVelocity({0, -4});
+    objects.push_back(std::move(box));
     Physics::Integrator{}.integrate(17ms, objects);
+
+    const auto position = box_reference.getBoundingPolygon().getPosition();
+    REQUIRE(position.x == doctest::Approx(1.5).epsilon(0.02));
+    REQUIRE(position.y == doctest::Approx(2.5).epsilon(0.02));
+    REQUIRE(box_reference.isTouchingGround());
+  }
+}
+
+TEST_CASE("Physics::Integrator derives the substep length from the size of each object") {
+  std::vector<std::unique_ptr<Physics::Object>> objects;
+  objects.push_back(std::make_unique<Physics::StaticObject>(
+      std::initializer_list<glm::vec2>{{-5, 0}, {5, 0}}));
+
+  SUBCASE("Small objects get swept at low speeds") {
+    auto box = std::make_unique<Physics::DynamicObject>(
+        std::initializer_list<glm::vec2>{{-0.05, 0.03}, {0.05, 0.03}, {0.05, 0.13}, {-0.05, 0.13}});
+    auto &box_reference = *box;
+    box->setGravity(0);
+    box->setVelocity({0, -0.14});
+    objects.push_back(std::move(box));
+    Physics::Integrator{}.integrate(17ms, objects);
+
+    REQUIRE(box_reference.getBoundingPolygon().getBoundingBox().min.y ==
+            doctest::Approx(0).epsilon(0.001));
+    REQUIRE(box_reference.isTouchingGround());
+  }
+
+  SUBCASE("Large objects move without being swept") {
+    /* Close to the path of the box, but never touched by it. Sweeps would test against it. */
+    auto obstacle = std::make_unique<CountingStaticObject>(
+        std::initializer_list<glm::vec2>{{-3.3, 1.1}, {-3.1, 1.1}, {-3.1, 1.3}, {-3.3, 1.3}});
+    auto &obstacle_reference = *obstacle;
+    objects.push_back(std::move(obstacle));
+    const auto count_polygon_requests = [&](const float safety_factor, const glm::vec2 velocity) {
+      auto box = std::make_unique<Physics::DynamicObject>(
+          std::initializer_list<glm::vec2>{{-2, 1}, {2, 1}, {2, 5}, {-2, 5}});
+      box->setGravity(0);
+      box->setVelocity(velocity);
+      objects.resize(2);
+      objects.push_back(std::move(box));
+
+      Physics::Integrator integrator{};
+      integrator.setSubstepSafetyFactor(safety_factor);
+      obstacle_reference.polygon_requests = 0;
+      integrator.integrate(17ms, objects);
+      return obstacle_reference.polygon_requests;
+    };
+
+    const auto requests_at_rest = count_polygon_requests(0.5, {0, 0});
+    REQUIRE(count_polygon_requests(0.5, {-1.2, 1.2}) == requests_at_rest);
+    REQUIRE(count_polygon_requests(0.1, {-1.2, 1.2}) > requests_at_rest);
+    REQUIRE(obstacle_reference.collisions == 0);
+  }
+}
+
+TEST_CASE("Physics::Integrator never checks static objects against each other") {
+  std::vector<std::unique_ptr<Physics::Object>> objects;
+  auto first = std::make_unique<CountingStaticObject>(
+      std::initializer_list<glm::vec2>{{-1, -1}, {1, -1}, {1, 1}, {-1, 1}});
+  auto second = std::make_unique<CountingStaticObject>(
+      std::initializer_list<glm::vec2>{{0, 0}, {2, 0}, {2, 2}, {0, 2}});
+  const auto &first_reference = *first;
+  const auto &second_reference = *second;
+  objects.push_back(std::move(first));
+  objects.push_back(std::move(second));
+  objects.push_back(std::make_unique<KinematicBox>(
+      std::initializer_list<glm::vec2>{{-0.5, -0.5}, {0.5, -0.5}, {0.5, 0.5}, {-0.5, 0.5}},
+      glm::vec2{0.1, 0}));
+
+  Physics::Integrator integrator{};
+  integrator.integrate(17ms, objects);
+  const auto first_requests = first_reference.polygon_requests;
+  const auto second_requests = second_reference.polygon_requests;
+
+  /* Static objects only get read when they enter the object list, so ticks never test them
+   * against each other. */
+  integrator.integrate(17ms * 10, objects);
+  REQUIRE(first_reference.polygon_requests == first_requests);
+  REQUIRE(second_reference.polygon_requests == second_requests);
+  REQUIRE(first_reference.collisions == 0);
+  REQUIRE(second_reference.collisions == 0);
+  REQUIRE(integrator.getStatistics().narrowphase_tests == 0);
+  REQUIRE(integrator.getStatistics().collisions == 0);
+}
+
+TEST_CASE("Physics::Integrator reads recycled objects again after invalidation") {
+  ObjectPool<Physics::StaticObject> walls;
+  const auto wall =
+      walls.create(std::initializer_list<glm::vec2>{{-5, -1}, {-4, -1}, {-4, 0}, {-5, 0}});
+  auto *const wall_address = walls.get(wall);
+  Physics::DynamicObject box{{-0.25, 1}, {0.25, 1}, {0.25, 1.5}, {-0.25, 1.5}};
+  const std::vector<Physics::Object *> objects{&box, wall_address};
+
+  Physics::Integrator integrator{};
+  integrator.integrate(17ms, objects);
+
+  /* The floor reuses the slot of the wall, which makes it indistinguishable by its address. */
+  walls.destroy(wall);
+  const auto floor =
+      walls.create(std::initializer_list<glm::vec2>{{-5, -1}, {5, -1}, {5, 0}, {-5, 0}});
+  REQUIRE(walls.get(floor) == wall_address);
+  integrator.invalidate(1);
+
+  for (int frame = 0; frame < 60; ++frame) {
+    integrator.integrate(17ms, objects);
+  }
+  REQUIRE(box.getBoundingPolygon().getBoundingBox().min.y == doctest::Approx(0).epsilon(0.001));
+  REQUIRE(box.isTouchingGround());
+
+  std::vector<size_t> result;
+  integrator.queryArea({{2, -1}, {3, -0.5}}, result);
+  REQUIRE(result == std::vector<size_t>{1});
+}
+
+TEST_CASE("Physics::Integrator reads changed static objects again after invalidation") {
+  Physics::StaticObject floor{{-5, -1}, {5, -1}, {5, 0}, {-5, 0}};
+  Physics::DynamicObject box{{-0.25, 1}, {0.25, 1}, {0.25, 1.5}, {-0.25, 1.5}};
+  const std::vector<Physics::Object *> objects{&floor, &box};
+  Physics::Integrator integrator{};
+  integrator.integrate(17ms, objects);
+
+  floor.setCollisionMask(0b10);
+  integrator.invalidate(0);
+  for (int frame = 0; frame < 60; ++frame) {
+    integrator.integrate(17ms, objects);
   }
+  REQUIRE(box.getBoundingPolygon().getBoundingBox().max.y < -1);
+  REQUIRE_FALSE(box.isTouchingGround());
+}
+
+TEST_CASE("Physics::Integrator moves kinematic objects without stopping them") {
+  std::vector<std::unique_ptr<Physics::Object>> objects;
+  objects.push_back(std::make_unique<Physics::StaticObject>(
+      std::initializer_list<glm::vec2>{{1.5, -1}, {1.6, -1}, {1.6, 2}, {1.5, 2}}));
+  auto pusher = std::make_unique<KinematicBox>(
+      std::initializer_list<glm::vec2>{{0, 0}, {1, 0}, {1, 0.5}, {0, 0.5}}, glm::vec2{0.2, 0});
+  auto &pusher_reference = *pusher;
+  auto box = std::make_unique<Physics::DynamicObject>(
+      std::initializer_list<glm::vec2>{{2, 0}, {2.5, 0}, {2.5, 0.5}, {2, 0.5}});
+  auto &box_reference = *box;
+  box->setGravity(0);
+  objects.push_back(std::move(pusher));
+  objects.push_back(std::move(box));
+
+  Physics::Integrator integrator{};
+  integrator.integrate(17ms * 10, objects);
+
+  const auto &pusher_box = pusher_reference.getBoundingPolygon().getBoundingBox();
+  REQUIRE(pusher_box.min.x == doctest::Approx(2));
+  REQUIRE(box_reference.getBoundingPolygon().getBoundingBox().min.x >=
+          doctest::Approx(pusher_box.max.x).epsilon(0.001));
+}
+
+TEST_CASE("Physics::Integrator moves fast kinematic objects in steps") {
+  std::vector<std::unique_ptr<Physics::Object>> objects;
+  auto pusher = std::make_unique<KinematicBox>(
+      std::initializer_list<glm::vec2>{{0, 0}, {1, 0}, {1, 0.5}, {0, 0.5}}, glm::vec2{3, 0});
+  auto &pusher_reference = *pusher;
+  auto box = std::make_unique<Physics::DynamicObject>(
+      std::initializer_list<glm::vec2>{{2, 0}, {2.5, 0}, {2.5, 0.5}, {2, 0.5}});
+  auto &box_reference = *box;
+  box->setGravity(0);
+  objects.push_back(std::move(pusher));
+  objects.push_back(std::move(box));
+
+  /* Moving the whole distance in a single step would pass through the box. */
+  Physics::Integrator{}.integrate(17ms, objects);
+  const auto &pusher_box = pusher_reference.getBoundingPolygon().getBoundingBox();
+  REQUIRE(pusher_box.min.x == doctest::Approx(3));
+  REQUIRE(box_reference.getBoundingPolygon().getBoundingBox().min.x >=
+          doctest::Approx(pusher_box.max.x).epsilon(0.001));
+}
+
+TEST_CASE("Physics::Integrator filters collisions by layer") {
+  std::vector<std::unique_ptr<Physics::Object>> objects;
+  auto floor = std::make_unique<Physics::StaticObject>(
+      std::initializer_list<glm::vec2>{{-5, -1}, {5, -1}, {5, 0}, {-5, 0}});
+  floor->setCollisionLayers(0b01);
+  floor->setCollisionMask(0b01);
+  auto box = std::make_unique<Physics::DynamicObject>(
+      std::initializer_list<glm::vec2>{{-0.25, 1}, {0.25, 1}, {0.25, 1.5}, {-0.25, 1.5}});
+  auto &box_reference = *box;
+  objects.push_back(std::move(floor));
+  objects.push_back(std::move(box));
+
+  SUBCASE("Objects on layers excluded by the mask of the other pass through") {
+    box_reference.setCollisionLayers(0b10);
+  }
+  SUBCASE("Objects excluding the layers of the other pass through") {
+    box_reference.setCollisionMask(0b10);
+  }
+
+  Physics::Integrator integrator{};
+  for (int frame = 0; frame < 60; ++frame) {
+    integrator.integrate(17ms, objects);
+  }
+  REQUIRE(box_reference.getBoundingPolygon().getBoundingBox().max.y < -1);
+  REQUIRE_FALSE(box_reference.isTouchingGround());
+}
+
+TEST_CASE("Physics::Integrator lets objects on shared layers collide") {
+  std::vector<std::unique_ptr<Physics::Object>> objects;
+  auto floor = std::make_unique<Physics::StaticObject>(
+      std::initializer_list<glm::vec2>{{-5, -1}, {5, -1}, {5, 0}, {-5, 0}});
+  floor->setCollisionLayers(0b11);
+  floor->setCollisionMask(0b10);
+  auto box = std::make_unique<Physics::DynamicObject>(
+      std::initializer_list<glm::vec2>{{-0.25, 1}, {0.25, 1}, {0.25, 1.5}, {-0.25, 1.5}});
+  auto &box_reference = *box;
+  box->setCollisionLayers(0b10);
+  box->setCollisionMask(0b01);
+  objects.push_back(std::move(floor));
+  objects.push_back(std::move(box));
+
+  Physics::Integrator integrator{};
+  for (int frame = 0; frame < 60; ++frame) {
+    integrator.integrate(17ms, objects);
+  }
+  REQUIRE(box_reference.getBoundingPolygon().getBoundingBox().min.y ==
+          doctest::Approx(0).epsilon(0.001));
+  REQUIRE(box_reference.isTouchingGround());
+}
+
+TEST_CASE("Physics::Integrator reports the largest motion of the last tick") {
+  std::vector<std::unique_ptr<Physics::Object>> objects;
+  objects.push_back(std::make_unique<Physics::StaticObject>(
+      std::initializer_list<glm::vec2>{{-5, -1}, {5, -1}, {5, 0}, {-5, 0}}));
+  for (const float speed : {0.5f, 3.0f}) {
+    const auto y = speed * 2;
+    auto box = std::make_unique<Physics::DynamicObject>(
+        std::initializer_list<glm::vec2>{{0, y}, {0.5, y}, {0.5, y + 0.5f}, {0, y + 0.5f}});
+    box->setGravity(0);
+    box->setAirFriction(0);
+    box->setVelocity({speed, 0});
+    objects.push_back(std::move(box));
+  }
+
+  Physics::Integrator integrator{};
+  REQUIRE(integrator.getLargestMotion() == 0);
+  integrator.integrate(17ms, objects);
+  REQUIRE(integrator.getLargestMotion() == doctest::Approx(3));
+}
+
+TEST_CASE("Physics::Integrator counts processed ticks") {
+  const std::vector<std::unique_ptr<Physics::Object>> objects;
+  Physics::Integrator integrator{};
+  REQUIRE(integrator.getTickCount() == 0);
+
+  integrator.integrate(10ms, objects);
+  REQUIRE(integrator.getTickCount() == 0);
+
+  integrator.integrate(10ms, objects);
+  REQUIRE(integrator.getTickCount() == 1);
+
+  integrator.integrate(17ms * 3, objects);
+  REQUIRE(integrator.getTickCount() == 4);
+
+  integrator.integrate(20min, objects);
+  REQUIRE(integrator.getTickCount() == 14);
+}
+
+TEST_CASE("Physics::Integrator collects statistics about the last integrate() call") {
+  const auto objects = makeFallingBoxes();
+  Physics::Integrator integrator{};
+  integrator.integrate(17ms * 3, objects);
+
+  const auto &statistics = integrator.getStatistics();
+  if (!Physics::Integrator::isStatisticsEnabled()) {
+    REQUIRE(statistics.ticks == 0);
+    REQUIRE(statistics.substeps == 0);
+    REQUIRE(statistics.narrowphase_tests == 0);
+    REQUIRE(statistics.update_time == 0ns);
+    return;
+  }
+  REQUIRE(statistics.ticks == 3);
+  REQUIRE(statistics.substeps >= 3 * 32);
+  REQUIRE(statistics.collisions <= statistics.narrowphase_tests);
+
+  SUBCASE("Counters get reset by each call") {
+    integrator.integrate(17ms, objects);
+    REQUIRE(integrator.getStatistics().ticks == 1);
+  }
+
+  SUBCASE("Boxes landing on the floor collide") {
+    for (int frame = 0; frame < 60; ++frame) {
+      integrator.integrate(17ms, objects);
+      if (integrator.getStatistics().collisions > 0) {
+        break;
+      }
+    }
+    REQUIRE(integrator.getStatistics().collisions > 0);
+    REQUIRE(integrator.getStatistics().narrowphase_tests > 0);
+  }
+}
+
+TEST_CASE("Physics::Integrator counts motion dropped at the step limit") {
+  /* Each box in the row stops the sweep of the fast box once. */
+  std::vector<std::unique_ptr<Physics::Object>> objects;
+  for (int index = 0; index < 24; ++index) {
+    const auto x = index * 0.5f;
+    auto box = std::make_unique<Physics::DynamicObject>(
+        std::initializer_list<glm::vec2>{{x, 0}, {x + 0.1f, 0}, {x + 0.1f, 0.1f}, {x, 0.1f}});
+    box->setGravity(0);
+    objects.push_back(std::move(box));
+  }
+  auto fast_box = std::make_unique<Physics::DynamicObject>(
+      std::initializer_list<glm::vec2>{{-1, 0}, {-0.9, 0}, {-0.9, 0.1}, {-1, 0.1}});
+  fast_box->setGravity(0);
+  fast_box->setVelocity({20, 0});
+  objects.push_back(std::move(fast_box));
+
+  Physics::Integrator integrator{};
+  integrator.integrate(17ms, objects);
+  REQUIRE(integrator.getStatistics().dropped_motions ==
+          (Physics::Integrator::isStatisticsEnabled() ? 1 : 0));
 }
 
 TEST_CASE("Physics::Integrator returns correct remainder value for interpolation") {
   const auto integrate = [](const std::chrono::microseconds time) {
     Physics::Integrator integrator{};
-    integrator.integrate(time, {});
+    integrator.integrate(time, no_objects);
     return integrator.getRendererInterpolationValue();
   };
 
@@ -272,7 +732,7 @@ TEST_CASE("Physics::Integrator returns correct remainder value for interpolation
 TEST_CASE("Physics::Integrator accumulates remainder value for interpolation properly") {
   Physics::Integrator integrator{};
   const auto integrate = [&](const std::chrono::microseconds time) {
-    integrator.integrate(time, {});
+    integrator.integrate(time, no_objects);
     return integrator.getRendererInterpolationValue();
   };
 
@@ -287,7 +747,7 @@ TEST_CASE("Physics::Integrator accumulates remainder value for interpolation pro
 
 TEST_CASE("Physics::Integrator considers capped frame times when computing remainder") {
   Physics::Integrator integrator{};
-  integrator.integrate(20min, {});
+  integrator.integrate(20min, no_objects);
   REQUIRE(integrator.getRendererInterpolationValue() == doctest::Approx(0));
 }
 
@@ -305,6 +765,155 @@ TEST_CASE("Physics::Integrator speed factor getter and setter") {
   }
 }
 
+TEST_CASE("Physics::Integrator substep safety factor getter and setter") {
+  Physics::Integrator integrator{};
+  REQUIRE(integrator.getSubstepSafetyFactor() == doctest::Approx(0.5));
+
+  SUBCASE("Clamping") {
+    integrator.setSubstepSafetyFactor(-1);
+    REQUIRE(integrator.getSubstepSafetyFactor() > 0);
+
+    integrator.setSubstepSafetyFactor(7);
+    REQUIRE(integrator.getSubstepSafetyFactor() == doctest::Approx(1));
+  }
+
+  SUBCASE("Setting valid values") {
+    integrator.setSubstepSafetyFactor(0.25);
+    REQUIRE(integrator.getSubstepSafetyFactor() == doctest::Approx(0.25));
+  }
+}
+
+TEST_CASE("Physics::Integrator broadphase cell size getter and setter") {
+  Physics::Integrator integrator{};
+
+  SUBCASE("Clamping") {
+    integrator.setBroadphaseCellSize(-3);
+    REQUIRE(integrator.getBroadphaseCellSize() > 0);
+  }
+
+  SUBCASE("Setting valid values") {
+    integrator.setBroadphaseCellSize(4.5);
+    REQUIRE(integrator.getBroadphaseCellSize() == doctest::Approx(4.5));
+  }
+}
+
+TEST_CASE("Physics::Integrator worker count getter and setter") {
+  Physics::Integrator integrator{};
+  REQUIRE(integrator.getWorkerCount() == 0);
+
+  integrator.setWorkerCount(3);
+  REQUIRE(integrator.getWorkerCount() == 3);
+
+  integrator.setWorkerCount(0);
+  REQUIRE(integrator.getWorkerCount() == 0);
+}
+
+TEST_CASE("Physics::Integrator stays usable after being moved from") {
+  std::vector<std::unique_ptr<Physics::Object>> objects;
+  objects.push_back(std::make_unique<Physics::StaticObject>(
+      std::initializer_list<glm::vec2>{{-5, -1}, {5, -1}, {5, 0}, {-5, 0}}));
+  Physics::Integrator integrator{};
+  integrator.setWorkerCount(1);
+  integrator.setBroadphaseCellSize(4);
+  integrator.integrate(17ms, objects);
+
+  SUBCASE("Move construction") { const Physics::Integrator other{std::move(integrator)}; }
+  SUBCASE("Move assignment") {
+    Physics::Integrator other{};
+    other = std::move(integrator);
+  }
+
+  REQUIRE(integrator.getTickCount() == 0);
+  REQUIRE(integrator.getWorkerCount() == 0);
+  REQUIRE(integrator.getBroadphaseCellSize() == doctest::Approx(2));
+  REQUIRE(integrator.getLargestMotion() == 0);
+
+  std::vector<size_t> result;
+  integrator.queryArea({{-1, -1}, {1, 1}}, result);
+  REQUIRE(result.empty());
+  integrator.integrate(17ms, objects);
+  integrator.queryArea({{-1, -1}, {1, 1}}, result);
+  REQUIRE(result == std::vector<size_t>{0});
+  REQUIRE(integrator.getTickCount() == 1);
+}
+
+TEST_CASE("Physics::Integrator produces the same results regardless of the worker count") {
+  const auto parallel_positions = simulate(1);
+  REQUIRE(simulate(2) == parallel_positions);
+  REQUIRE(simulate(4) == parallel_positions);
+}
+
+TEST_CASE("Physics::Integrator reports static collisions in the same order for any worker count") {
+  const auto record_collisions = [](const size_t worker_count) {
+    /* Boxes in all columns land on the same floor, but in different islands. */
+    auto objects = makeFallingBoxes();
+    auto floor = std::make_unique<RecordingStaticObject>(
+        std::initializer_list<glm::vec2>{{-2, -1}, {24, -1}, {24, 0.01}, {-2, 0.01}});
+    const auto &floor_reference = *floor;
+    objects.push_back(std::move(floor));
+
+    Physics::Integrator integrator{};
+    integrator.setWorkerCount(worker_count);
+    for (int frame = 0; frame < 60; ++frame) {
+      integrator.integrate(17ms, objects);
+    }
+    return floor_reference.colliding_positions;
+  };
+
+  const auto collisions = record_collisions(1);
+  REQUIRE_FALSE(collisions.empty());
+  REQUIRE(record_collisions(2) == collisions);
+  REQUIRE(record_collisions(4) == collisions);
+}
+
+TEST_CASE("Physics::Integrator produces similar results in serial and parallel mode") {
+  const auto serial_positions = simulate(0);
+  const auto parallel_positions = simulate(1);
+  for (size_t index = 0; index < serial_positions.size(); ++index) {
+    /* Boxes came to rest on their floor in both modes. */
+    REQUIRE(parallel_positions[index].x == doctest::Approx(serial_positions[index].x));
+    REQUIRE(parallel_positions[index].y == doctest::Approx(serial_positions[index].y));
+  }
+}
+
+/* Only holds for polygons with at most 8 separating axes, which fit into a Geometry::VertexList
+ * without heap allocations. */
+TEST_CASE("Physics::Integrator does not allocate memory once warmed up") {
+  auto objects = makeFallingBoxes();
+  const auto box_count = objects.size() - 8;
+  for (const auto &wall : std::initializer_list<std::initializer_list<glm::vec2>>{
+           {{-2, -1}, {-1, -1}, {-1, 6}, {-2, 6}},
+           {{23, -1}, {24, -1}, {24, 6}, {23, 6}},
+           {{-2, 6}, {24, 6}, {24, 7}, {-2, 7}},
+           {{-2, -1}, {24, -1}}}) {
+    objects.push_back(std::make_unique<Physics::StaticObject>(wall));
+  }
+
+  /* Keep all boxes moving back and forth inside the room. */
+  const auto integrate_frame = [&](Physics::Integrator &integrator, const int frame) {
+    for (size_t index = 8; index < 8 + box_count; ++index) {
+      static_cast<Physics::DynamicObject &>(*objects[index])
+          .setVelocity({frame % 40 < 20 ? 0.2 : -0.2, 0.1});
+    }
+    integrator.integrate(17ms, objects);
+  };
+
+  for (const size_t worker_count : {0, 2}) {
+    Physics::Integrator integrator{};
+    integrator.setWorkerCount(worker_count);
+    int frame = 0;
+    for (; frame < 600; ++frame) {
+      integrate_frame(integrator, frame);
+    }
+
+    const auto allocations_before = allocation_count.load();
+    for (const auto last_frame = frame + 120; frame < last_frame; ++frame) {
+      integrate_frame(integrator, frame);
+    }
+    REQUIRE(allocation_count.load() == allocations_before);
+  }
+}
+
 TEST_CASE("Physics::Integrator has adjustable simulation speed") {
   std::vector<std::unique_ptr<Physics::Object>> objects;
   objects.push_back(std::make_unique<MockObject>());
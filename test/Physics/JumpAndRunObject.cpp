@@ -0,0 +1,65 @@
+/** @file
+ * Tests objects with jump-and-run mechanics.
+ */
+
+#include <GameEngine/Physics/Integrator.hpp>
+#include <GameEngine/Physics/JumpAndRunObject.hpp>
+#include <GameEngine/Physics/StaticObject.hpp>
+#include <doctest/doctest.h>
+
+using namespace GameEngine;
+
+namespace {
+/** Floor at y = 0 and a jump-and-run object whose bottom is at the given height above it. */
+std::vector<std::unique_ptr<Physics::Object>> makeCharacterAboveFloor(const float height) {
+  std::vector<std::unique_ptr<Physics::Object>> objects;
+  objects.push_back(std::make_unique<Physics::StaticObject>(
+      std::initializer_list<glm::vec2>{{-5, -1}, {5, -1}, {5, 0}, {-5, 0}}));
+  objects.push_back(std::make_unique<Physics::JumpAndRunObject>(std::initializer_list<glm::vec2>{
+      {-0.25, height}, {0.25, height}, {0.25, height + 1}, {-0.25, height + 1}}));
+  return objects;
+}
+
+/** Advance the simulation by the given amount of ticks as fast as possible.
+ *
+ * @return Highest upwards velocity observed after any tick.
+ */
+float runTicks(Physics::Integrator &integrator,
+               const std::vector<std::unique_ptr<Physics::Object>> &objects, const size_t ticks) {
+  float velocity_max = 0;
+  for (size_t tick = 0; tick < ticks; ++tick) {
+    integrator.integrate(Physics::Integrator::getTickDuration(), objects);
+    velocity_max = glm::max(velocity_max, objects.back()->getVelocity().y);
+  }
+  return velocity_max;
+}
+} // namespace
+
+TEST_CASE("Physics::JumpAndRunObject buffers jump requests for a few ticks") {
+  Physics::Integrator integrator{};
+
+  SUBCASE("Jump from the ground") {
+    const auto objects = makeCharacterAboveFloor(0.5);
+    auto &character = static_cast<Physics::JumpAndRunObject &>(*objects.back());
+    runTicks(integrator, objects, 120);
+    REQUIRE(character.isTouchingGround());
+
+    character.jump();
+    REQUIRE(runTicks(integrator, objects, 1) > 0.1);
+  }
+
+  SUBCASE("Jump requested shortly before landing") {
+    const auto objects = makeCharacterAboveFloor(0.1);
+    auto &character = static_cast<Physics::JumpAndRunObject &>(*objects.back());
+    character.jump();
+    REQUIRE(runTicks(integrator, objects, 6) > 0.1);
+  }
+
+  SUBCASE("Jump requested long before landing gets dropped") {
+    const auto objects = makeCharacterAboveFloor(3);
+    auto &character = static_cast<Physics::JumpAndRunObject &>(*objects.back());
+    character.jump();
+    REQUIRE(runTicks(integrator, objects, 120) == 0);
+    REQUIRE(character.isTouchingGround());
+  }
+}
@@ -0,0 +1,124 @@
+/** @file
+ * Tests baked level geometry.
+ */
+
+#include <GameEngine/Physics/DynamicObject.hpp>
+#include <GameEngine/Physics/Integrator.hpp>
+#include <GameEngine/Physics/StaticGeometry.hpp>
+#include <doctest/doctest.h>
+
+using namespace GameEngine;
+
+namespace {
+void requireSegment(const ConvexBoundingPolygon &shape, const glm::vec2 start,
+                    const glm::vec2 end) {
+  const auto &vertices = shape.getVertices();
+  REQUIRE(vertices.size() == 2);
+  REQUIRE(vertices[0] == start);
+  REQUIRE(vertices[1] == end);
+}
+} // namespace
+
+TEST_CASE("Physics::StaticGeometry merges touching collinear segments") {
+  const Physics::StaticGeometry geometry{{
+      {{0, 0}, {2, 0}},
+      {{4, 0}, {2, 0}},
+      {{3, 0}, {5, 0}},
+      {{0, 1}, {5, 1}},
+      {},
+      {{6, 0}, {8, 0}},
+      {{0, 0}, {1, 1}, {1, 0}},
+  }};
+
+  const auto &shapes = geometry.getShapes();
+  REQUIRE(shapes.size() == 4);
+  requireSegment(shapes[0], {0, 0}, {5, 0});
+  requireSegment(shapes[1], {0, 1}, {5, 1});
+  requireSegment(shapes[2], {6, 0}, {8, 0});
+  REQUIRE(shapes[3].getVertices().size() == 3);
+
+  REQUIRE(geometry.getBoundingBox().min == glm::vec2{0, 0});
+  REQUIRE(geometry.getBoundingBox().max == glm::vec2{8, 1});
+}
+
+TEST_CASE("Physics::StaticGeometry merges neighbouring polygons into convex polygons") {
+  const Physics::StaticGeometry geometry{{
+      {{0, 0}, {1, 0}, {1, 1}, {0, 1}},
+      {{1, 0}, {1, 1}, {2, 1}, {2, 0}},
+      {{2, 0}, {3, 0}, {3, 1}, {2, 1}},
+      {{0, 1}, {1, 1}, {1, 2}, {0, 2}},
+      {{5, 0}, {6, 0}, {6, 1}, {5, 1}},
+      {{6, 0.5}, {7, 0.5}, {7, 1.5}, {6, 1.5}},
+  }};
+
+  const auto &shapes = geometry.getShapes();
+  REQUIRE(shapes.size() == 4);
+  REQUIRE(shapes[0].getVertices().size() == 4);
+  REQUIRE(shapes[0].getBoundingBox().min == glm::vec2{0, 0});
+  REQUIRE(shapes[0].getBoundingBox().max == glm::vec2{3, 1});
+  REQUIRE(shapes[1].getBoundingBox().min == glm::vec2{0, 1});
+  REQUIRE(shapes[1].getBoundingBox().max == glm::vec2{1, 2});
+  REQUIRE(shapes[2].getBoundingBox().min == glm::vec2{5, 0});
+  REQUIRE(shapes[3].getBoundingBox().min == glm::vec2{6, 0.5});
+}
+
+TEST_CASE("Physics::StaticGeometry finds shapes in an area") {
+  const Physics::StaticGeometry geometry{{
+      {{0, 0}, {1, 0}, {1, 1}},
+      {{20, 0}, {21, 0}, {21, 1}},
+      {{40, 0}, {41, 0}, {41, 1}},
+  }};
+
+  std::vector<size_t> result{7};
+  geometry.queryArea({{19, -1}, {42, 2}}, result);
+  std::vector<size_t> expected{1, 2};
+  REQUIRE(result == expected);
+
+  geometry.queryArea({{5, 5}, {6, 6}}, result);
+  REQUIRE(result.empty());
+}
+
+TEST_CASE("Physics::StaticGeometry collides with moving objects") {
+  std::vector<std::unique_ptr<Physics::Object>> objects;
+  objects.push_back(std::make_unique<Physics::StaticGeometry>(std::vector<Geometry::VertexList>{
+      {{-5, 0}, {-1, 0}},
+      {{-1, 0}, {5, 0}},
+      {{-5, 10}, {5, 10}},
+  }));
+  objects.push_back(std::make_unique<Physics::DynamicObject>(
+      std::initializer_list<glm::vec2>{{-0.25, 2}, {0.25, 2}, {0.25, 2.5}, {-0.25, 2.5}}));
+  Physics::Integrator integrator{};
+
+  for (size_t tick = 0; tick < 300; ++tick) {
+    integrator.integrate(Physics::Integrator::getTickDuration(), objects);
+  }
+  const auto &box = *objects.back();
+  REQUIRE(box.getBoundingPolygon().getBoundingBox().min.y == doctest::Approx(0).epsilon(0.01));
+  REQUIRE(glm::abs(box.getVelocity().y) < 0.01);
+
+  std::vector<size_t> visible_objects;
+  integrator.queryArea({{-1, -1}, {1, 1}}, visible_objects);
+  std::vector<size_t> expected{0, 1};
+  REQUIRE(visible_objects == expected);
+}
+
+TEST_CASE("Physics::StaticGeometry finds the first shape along a line segment") {
+  const Physics::StaticGeometry geometry{{
+      {{4, -1}, {4, 1}},
+      {{8, -1}, {10, -1}, {10, 1}, {8, 1}},
+      {{2, 2}, {2, 3}, {3, 2}},
+  }};
+
+  auto hit = geometry.raycast({0, 0}, {20, 0});
+  REQUIRE(hit);
+  REQUIRE(hit->index == 0);
+  REQUIRE(hit->fraction == doctest::Approx(0.2));
+
+  hit = geometry.raycast({20, 0}, {0, 0});
+  REQUIRE(hit);
+  REQUIRE(hit->index == 1);
+  REQUIRE(hit->fraction == doctest::Approx(0.5));
+
+  REQUIRE_FALSE(geometry.raycast({0, 0}, {3, 0}));
+  REQUIRE_FALSE(geometry.raycast({0, 2.5}, {2.5, 4}));
+}
@@ -0,0 +1,48 @@
+/** @file
+ * Tests the thread pool.
+ */
+
+#include <GameEngine/ThreadPool.hpp>
+#include <doctest/doctest.h>
+#include <stdexcept>
+
+using namespace GameEngine;
+
+TEST_CASE("ThreadPool runs each task exactly once") {
+  for (const size_t worker_count : {0, 1, 4}) {
+    ThreadPool thread_pool{worker_count};
+    REQUIRE(thread_pool.getWorkerCount() == worker_count);
+
+    std::vector<std::atomic<int>> calls(1000);
+    for (size_t round = 0; round < 3; ++round) {
+      thread_pool.forEach(calls.size(), [&](const size_t task_index) { ++calls[task_index]; });
+    }
+    for (const auto &call_count : calls) {
+      REQUIRE(call_count == 3);
+    }
+  }
+}
+
+TEST_CASE("ThreadPool does nothing without tasks") {
+  ThreadPool thread_pool{2};
+  thread_pool.forEach(0, [](size_t) { FAIL("Unexpected task"); });
+}
+
+TEST_CASE("ThreadPool rethrows exceptions from tasks") {
+  ThreadPool thread_pool{3};
+  std::atomic<int> finished_tasks{0};
+  REQUIRE_THROWS_AS(thread_pool.forEach(100,
+                                        [&](const size_t task_index) {
+                                          if (task_index == 42) {
+                                            throw std::runtime_error{"Task failed"};
+                                          }
+                                          ++finished_tasks;
+                                        }),
+                    std::runtime_error);
+  REQUIRE(finished_tasks == 99);
+
+  /* Remains usable. */
+  finished_tasks = 0;
+  thread_pool.forEach(10, [&](size_t) { ++finished_tasks; });
+  REQUIRE(finished_tasks == 10);
+}